@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <ostream>
+#include "BranchBound.h"
+#include "Limits.h"
+#include <Eigen>
+
+//formatos do arquivo de resultados do lote
+#define CSV_RESULTS 1
+#define JSON_RESULTS 2
+
+//situação de uma instância que não pôde ser lida ou resolvida
+#define BATCH_ERROR 0
+
+using namespace Eigen;
+using namespace std;
+
+/**
+ * Resultado de uma instância do lote: situação (a do branch-and-bound ou BATCH_ERROR), valor e
+ * solução nas variáveis originais, nós, pivôs e tempo de relógio desde a leitura do arquivo
+ */
+struct BatchResult {
+    string fileName;
+    int status;
+    //motivo da parada quando um limite foi atingido
+    int reason;
+    bool foundSolution;
+    double optimum;
+    VectorXd solution;
+    long long nodes;
+    long long iterations;
+    //tempo de relógio da instância, em segundos
+    double time;
+    string error;
+};
+
+/**
+ * Lote: resolve muitos arquivos de modelo no mesmo processo. As instâncias ficam numa fila e um
+ * conjunto fixo de threads as retira uma a uma; cada instância é lida, passa pelo presolve e é
+ * resolvida pelo branch-and-bound com o seu próprio orçamento (os limites valem por instância).
+ * O orçamento do lote é o pai dos orçamentos das instâncias, então cancelá-lo para todas.
+ * Os resultados ficam na ordem de entrada e são escritos em CSV ou JSON.
+ */
+class Batch {
+    private:
+        vector<string> fileNames;
+        vector<BatchResult*> results;
+        atomic<long long> next;
+        int engine;
+        int nodeSelection;
+        int numberOfThreads;
+        int branching;
+        bool useHeuristics;
+        int cuts;
+        long long cutDepth;
+        long long cutRounds;
+        bool usePresolve;
+        bool usePropagation;
+        double relativeGap;
+        double absoluteGap;
+        double timeLimit;
+        long long nodeLimit;
+        long long iterationLimit;
+        long long memoryLimit;
+        Limits *limits;
+
+        void run();
+        void solve(BatchResult *result);
+        void writeCsv(ostream &output);
+        void writeJson(ostream &output);
+        static string getStatusName(BatchResult *result);
+        static string formatNumber(double value);
+        static string quoteCsv(const string &text);
+        static string quoteJson(const string &text);
+
+    public:
+        Batch(const vector<string> &fileNames, int numberOfWorkers = 0, int engine = TABLEAU_ENGINE, int nodeSelection = BEST_BOUND,
+            int numberOfThreads = 1, int branching = RELIABILITY, bool useHeuristics = true, int cuts = ROOT_CUTS,
+            long long cutDepth = CUT_MAX_DEPTH, long long cutRounds = CUT_ROOT_ROUNDS, bool usePresolve = true,
+            bool usePropagation = true, double relativeGap = DEFAULT_RELATIVE_GAP, double absoluteGap = DEFAULT_ABSOLUTE_GAP,
+            double timeLimit = NO_LIMIT, long long nodeLimit = NO_LIMIT, long long iterationLimit = NO_LIMIT,
+            long long memoryLimit = NO_LIMIT, Limits *limits = NULL);
+        ~Batch();
+        static vector<string> readInstances(const string path);
+        void write(ostream &output, int format);
+        vector<BatchResult*> getResults();
+        long long getSolved();
+        long long getErrors();
+};
@@ -1,37 +1,241 @@
 #pragma once
 
 #include <iostream>
-#include "Simplex.h"
+#include <vector>
+#include <set>
+#include <mutex>
+#include <atomic>
+#include "LPSolver.h"
+#include "PrimalHeuristics.h"
+#include "CutPool.h"
+#include "Separator.h"
+#include "Propagator.h"
+#include "Limits.h"
+#include "Incumbent.h"
 #include "Problem.h"
 #include <Eigen>
 
 #define MINIMIZE 1
 #define MAXIMIZE 2
 
+//políticas de seleção do próximo nó aberto
+#define BEST_BOUND 1
+#define DEPTH_FIRST 2
+#define BEST_ESTIMATE 3
+#define HYBRID 4
+
+//regras de escolha da variável de ramificação
+#define MOST_FRACTIONAL 1
+#define PSEUDOCOST 2
+#define STRONG_BRANCHING 3
+#define RELIABILITY 4
+
+//candidatos avaliados pelo strong branching em cada nó
+#define STRONG_CANDIDATES 8
+//pivôs do Simplex dual em cada filho avaliado pelo strong branching
+#define STRONG_PIVOT_LIMIT 20
+//observações de pseudocusto (em cada sentido) para a variável ser confiável
+#define RELIABILITY_THRESHOLD 4
+//menor ganho considerado no produto dos ganhos dos dois filhos
+#define SCORE_EPSILON 1e-6
+
+//nós explorados por thread entre dois mergulhos (o arredondamento roda em todo nó)
+#define HEURISTIC_FREQUENCY 10
+//semente das heurísticas primais (somada ao índice da thread)
+#define HEURISTIC_SEED 1
+
+//separação de cortes no branch-and-cut
+#define NO_CUTS 0
+#define ROOT_CUTS 1
+#define TREE_CUTS 2
+//rodadas de separação na raiz
+#define CUT_ROOT_ROUNDS 20
+//rodadas de separação em cada nó da árvore
+#define CUT_NODE_ROUNDS 2
+//profundidade máxima dos nós com separação
+#define CUT_MAX_DEPTH 5
+//melhora mínima do limite para continuar as rodadas de separação
+#define CUT_MIN_IMPROVEMENT 1e-6
+
+//menor custo reduzido usado na fixação por custo reduzido
+#define REDUCED_COST_TOLERANCE 1e-7
+
+//gaps padrão entre o incumbente e o limite dual para encerrar a busca
+#define DEFAULT_RELATIVE_GAP 0
+#define DEFAULT_ABSOLUTE_GAP 1e-6
+//evita a divisão por zero no gap relativo de um incumbente nulo
+#define GAP_EPSILON 1e-10
+//folga no arredondamento do limite dual quando a função objetivo só assume valores inteiros
+#define OBJECTIVE_INTEGER_TOLERANCE 1e-6
+//distância de um inteiro abaixo da qual o valor de uma variável inteira é considerado inteiro
+#define BRANCH_INTEGER_TOLERANCE 1e-6
+
 using namespace std;
 
+/**
+ * Alteração de limites de uma variável feita por uma ramificação
+ */
+struct BoundChange {
+    long long variable;
+    double lower;
+    double upper;
+};
+
+/**
+ * Nó aberto: apenas as alterações de limite em relação ao problema da raiz.
+ * A relaxação é reconstruída (e resolvida) somente quando o nó é explorado.
+ */
 struct Node {
-    Simplex *solver;
-    Problem *ilp;
-    Node *left;
-    Node *right;
+    vector<BoundChange> changes;
+    //alterações que o pai já tinha: as seguintes (fixações por custo reduzido, ramificação e
+    //propagação) são aplicadas sobre a relaxação do pai
+    size_t inherited;
+    //valor da relaxação do pai (limite dual do nó)
+    double bound;
+    //estimativa do melhor valor inteiro na subárvore
+    double estimate;
+    long long depth;
+    //ordem de criação, usada como desempate
+    long long id;
+    long long parentId;
+    //ramificação que criou o nó, usada para atualizar os pseudocustos
+    long long branchVariable;
+    bool branchUp;
+    double branchDistance;
+    //cortes inseridos nos ancestrais e no próprio nó (os da raiz já estão na relaxação da raiz)
+    vector<SparseVector<double> > cuts;
+    //limite do nó no conjunto de limites dos nós pendentes (ver getDualBound)
+    multiset<double>::iterator boundEntry;
+};
+
+/**
+ * Thread da busca: possui a sua própria fila de nós abertos, da qual as outras podem roubar
+ */
+struct Worker {
+    vector<Node*> openNodes;
+    mutex lock;
+    //cópia local da fase da política híbrida, usada na ordenação da fila
+    bool diving;
+    long long numberOfNodes;
+    //relaxação do último nó explorado, ponto de partida dos seus filhos
+    LPSolver *lastSolver;
+    long long lastId;
+    PrimalHeuristics *heuristics;
+    //separadores da thread (cada um acumula as suas estatísticas)
+    vector<Separator*> separators;
 };
 
 class BranchBound {
     private:
-        Node *root;
+        Problem *ilp;
+        LPSolver *rootSolver;
         int mode;
+        int engine;
+        int nodeSelection;
+        int numberOfThreads;
+        int branching;
+        bool useHeuristics;
+        bool usePropagation;
+        //propagação de domínios nas restrições do problema (compartilhada pelas threads)
+        Propagator *propagator;
+        atomic<long long> propagatedBounds;
+        atomic<long long> fixedBounds;
+        atomic<long long> prunedNodes;
+        double relativeGap;
+        double absoluteGap;
+        //true se toda solução inteira tem valor inteiro (custos inteiros)
+        bool integralObjective;
+        atomic<bool> gapClosed;
+        //limites dos nós abertos e em exploração: o melhor deles é o limite dual global
+        multiset<double> nodeBounds;
+        mutex boundLock;
+        //orçamento da busca (NULL sem limites) e situação do resultado
+        Limits *limits;
+        int status;
+        int cuts;
+        long long cutDepth;
+        long long cutRounds;
+        //cortes globais encontrados nos nós, compartilhados por toda a árvore
+        CutPool *cutPool;
+        mutex cutLock;
+        atomic<long long> appliedCuts;
+        double rootBound;
+        double cutBound;
+        atomic<long long> heuristicSolutions;
+        atomic<bool> diving;
         bool foundSolution;
-        double optimum;
+        atomic<double> optimum;
         VectorXd solution;
+        mutex incumbentLock;
+        //incumbente compartilhado com outros métodos (portfólio, NULL se não há) e última versão importada
+        Incumbent *sharedIncumbent;
+        atomic<long long> sharedVersion;
+        atomic<long long> importedSolutions;
+        vector<Worker*> workers;
+        atomic<long long> pendingNodes;
+        atomic<long long> createdNodes;
+        atomic<long long> nodeMemory;
+        atomic<long long> peakNodeMemory;
+        VectorXd pseudocostSum[2];
+        vector<long long> pseudocostCount[2];
+        mutex pseudocostLock;
 
         long long findBranch(VectorXd vectorToSearch);
-        void findSolutions(Node *node);
+        long long selectBranch(Node *node, LPSolver *solver);
+        void strongBranch(Node *node, LPSolver *solver, long long variable, double &downGain, double &upGain);
+        void updatePseudocost(long long variable, bool up, double distance, double gain);
+        double getPseudocost(long long variable, bool up);
+        bool isReliable(long long variable);
+        double getScore(double downGain, double upGain);
+        void findSolutions();
+        void work(int workerId);
+        LPSolver* solveNode(Worker *worker, Node *node);
+        void branch(Worker *worker, Node *node, LPSolver *solver, long long pos);
+        Node* createChild(Node *parent, const vector<BoundChange> &fixings, long long pos, double lower, double upper, bool up, double distance);
+        vector<BoundChange> fixByReducedCost(LPSolver *solver, VectorXd &lower, VectorXd &upper);
+        bool propagateNode(Node *node);
+        void getBounds(Node *node, long long variable, double &lower, double &upper);
+        void updateIncumbent(const VectorXd &solution, double optimum, bool heuristic);
+        void importIncumbent();
+        void runHeuristics(Worker *worker, Node *node, LPSolver *solver);
+        void separateCuts(Worker *worker, Node *node, LPSolver *solver, long long rounds);
+        void getNodeBounds(Node *node, VectorXd &lower, VectorXd &upper);
+        double getEstimate(LPSolver *solver);
+        void pushNode(Worker *worker, Node *node);
+        Node* popNode(Worker *worker);
+        Node* stealNode(int thiefId);
+        void releaseNode(Node *node);
+        void requeueNode(Worker *worker, Node *node);
+        bool isLimitReached();
+        long long getNodeSize(Node *node);
+        bool isWorseNode(Node *first, Node *second, bool diving);
         bool isBetterSolution(double optimumFound);
+        double roundBound(double bound);
+        bool isGapClosed();
 
     public:
-        BranchBound(Problem *ilp, int mode);
+        BranchBound(Problem *ilp, int mode, int engine = TABLEAU_ENGINE, int nodeSelection = BEST_BOUND,
+            int numberOfThreads = 1, int branching = RELIABILITY, bool useHeuristics = true,
+            int cuts = ROOT_CUTS, long long cutDepth = CUT_MAX_DEPTH, long long cutRounds = CUT_ROOT_ROUNDS,
+            bool usePropagation = true, double relativeGap = DEFAULT_RELATIVE_GAP, double absoluteGap = DEFAULT_ABSOLUTE_GAP,
+            Limits *limits = NULL, Incumbent *sharedIncumbent = NULL, int seed = HEURISTIC_SEED);
+        ~BranchBound();
         bool hasSolution();
+        int getStatus();
         double getOptimum();
         VectorXd getSolution();
+        double getDualBound();
+        double getGap();
+        long long getNumberOfNodes();
+        vector<long long> getNodesPerThread();
+        long long getPeakNodeMemory();
+        long long getHeuristicSolutions();
+        long long getImportedSolutions();
+        double getRootBound();
+        double getCutBound();
+        long long getAppliedCuts();
+        long long getPoolSize();
+        long long getPropagatedBounds();
+        long long getFixedBounds();
+        long long getPrunedNodes();
 };
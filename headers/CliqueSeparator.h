@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Separator.h"
+
+using namespace Eigen;
+using namespace std;
+
+//itens de uma mochila examinados na montagem do grafo de conflitos
+#define CLIQUE_ROW_LIMIT 500
+//literais usados como semente de uma clique em cada rodada
+#define CLIQUE_SEEDS 20
+
+/**
+ * Cortes de clique: o grafo de conflitos liga dois literais binários (x ou 1 - x) que não podem
+ * valer 1 ao mesmo tempo em alguma mochila do problema; uma clique C gera sum(C) <= 1.
+ */
+class CliqueSeparator : public Separator {
+    private:
+        //literal k < n é x_k, literal k >= n é 1 - x_(k - n); listas de adjacência ordenadas
+        vector<vector<long long> > conflicts;
+
+        bool isConflict(long long first, long long second);
+
+    protected:
+        void separate(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts);
+
+    public:
+        CliqueSeparator(Problem *ilp);
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Separator.h"
+
+using namespace Eigen;
+using namespace std;
+
+/**
+ * Cortes de cobertura de mochila estendidos. Cada restrição a.x <= b vira uma mochila nas
+ * variáveis binárias (com peso positivo, complementando as de coeficiente negativo); as outras
+ * variáveis são substituídas pela sua menor contribuição.
+ */
+class CoverSeparator : public Separator {
+    protected:
+        void separate(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts);
+
+    public:
+        CoverSeparator(Problem *ilp);
+};
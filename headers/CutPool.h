@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+
+using namespace Eigen;
+using namespace std;
+
+//menor eficácia (violação dividida pela norma) para um corte entrar no pool ou no PL
+#define CUT_MIN_EFFICACY 1e-6
+//cosseno acima do qual dois cortes são considerados o mesmo corte
+#define CUT_DUPLICATE_LIMIT 0.9999
+//cosseno máximo entre cortes escolhidos na mesma rodada
+#define CUT_PARALLELISM_LIMIT 0.99
+//rodadas seguidas com folga até o corte sair do PL
+#define CUT_AGE_LIMIT 3
+//rodadas fora do PL sem ser violado até o corte ser descartado do pool
+#define CUT_POOL_AGE_LIMIT 10
+//folga mínima para um corte ser considerado inativo
+#define CUT_SLACK_TOLERANCE 1e-6
+//cortes inseridos no PL em cada rodada
+#define MAX_CUTS_PER_ROUND 10
+
+/**
+ * Corte a.x >= b nas variáveis originais
+ */
+struct Cut {
+    //coeficientes do corte (o último é o lado direito, como nas restrições de Problem)
+    SparseVector<double> constraint;
+    double rhs;
+    double norm;
+    //rodadas seguidas com folga (no PL) ou sem violação (fora do PL)
+    long long age;
+    long long id;
+    //separador que gerou o corte
+    int family;
+    //true se o corte está no PL
+    bool active;
+};
+
+/**
+ * Pool de cortes: descarta cortes repetidos ou paralelos, escolhe os mais eficazes para o PL
+ * e envelhece os cortes com folga até eles saírem do PL e, depois, do pool.
+ */
+class CutPool {
+    private:
+        long long numberOfVariables;
+        vector<Cut*> cuts;
+        long long nextId;
+
+        double getEfficacy(Cut *cut, const VectorXd &point);
+        double getCosine(Cut *first, Cut *second);
+        vector<Cut*> rank(const VectorXd &point, long long limit);
+
+    public:
+        CutPool(long long numberOfVariables);
+        ~CutPool();
+        bool add(const SparseVector<double> &constraint, const VectorXd &point, int family);
+        vector<Cut*> select(const VectorXd &point, long long limit);
+        vector<Cut*> getViolated(const VectorXd &point, long long limit);
+        vector<Cut*> age(const VectorXd &point);
+        long long size();
+};
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <iostream>
+#include <vector>
 #include "Simplex.h"
+#include "CutPool.h"
+#include "Separator.h"
 #include "Problem.h"
+#include "Limits.h"
 #include <Eigen>
 
 #define MINIMIZE 1
@@ -13,21 +17,36 @@ using namespace std;
 class CuttingPlane {
     private:
         int mode;
+        Problem *ilp;
         long long numberOfVariables;
         bool foundSolution;
         double optimum;
         VectorXd solution;
-        MatrixXd cuts;
         Simplex *solver;
+        CutPool *pool;
+        vector<Separator*> separators;
+        //cortes de cada separador inseridos na última rodada
+        vector<long long> roundCuts;
+        long long rounds;
+        long long appliedCuts;
+        //orçamento (NULL sem limites), situação do resultado e último valor da relaxação
+        Limits *limits;
+        int status;
+        double dualBound;
 
-        bool gomoryCut(MatrixXd tableau);
-        void addCut(VectorXd cut);
-        long long getCutRow(MatrixXd tableau);
+        bool separate();
+        void registerImprovement(double improvement);
         bool isIntegerSolution(VectorXd solution);
 
     public:
-        CuttingPlane(Problem *ilp, int mode);
+        CuttingPlane(Problem *ilp, int mode, Limits *limits = NULL);
+        ~CuttingPlane();
         bool hasSolution();
+        int getStatus();
+        double getDualBound();
         double getOptimum();
         VectorXd getSolution();
+        long long getRounds();
+        long long getAppliedCuts();
+        vector<Separator*> getSeparators();
 };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Separator.h"
+#include "Simplex.h"
+
+using namespace Eigen;
+using namespace std;
+
+//distância de um inteiro abaixo da qual um coeficiente do tableau é considerado inteiro
+#define FRACTION_TOLERANCE 1e-9
+//linhas do tableau usadas para gerar cortes de Gomory em cada rodada (as mais fracionárias)
+#define GOMORY_ROWS 20
+
+/**
+ * Cortes fracionários de Gomory gerados das linhas do tableau ótimo (apenas com o Simplex tableau)
+ */
+class GomorySeparator : public Separator {
+    private:
+        VectorXd gomoryCut(Simplex *simplex, const MatrixXd &tableau, long long rowToCut);
+        vector<long long> getCutRows(const MatrixXd &tableau);
+
+    protected:
+        void separate(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts);
+
+    public:
+        GomorySeparator(Problem *ilp);
+        bool isLocal();
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Eigen>
+#include <mutex>
+#include <atomic>
+
+#define MINIMIZE 1
+#define MAXIMIZE 2
+
+using namespace Eigen;
+using namespace std;
+
+/**
+ * Incumbente compartilhado entre métodos que resolvem o mesmo problema ao mesmo tempo
+ * (portfólio): cada método oferece as suas soluções inteiras e importa as melhores dos outros.
+ * A versão muda a cada melhora, então consultar se há novidade não precisa de trava.
+ */
+class Incumbent {
+    private:
+        int mode;
+        bool found;
+        double value;
+        VectorXd solution;
+        atomic<long long> version;
+        mutex lock;
+
+    public:
+        Incumbent(int mode);
+        bool offer(const VectorXd &solution, double value);
+        bool get(VectorXd &solution, double &value, long long &version);
+        long long getVersion();
+        bool hasSolution();
+        double getValue();
+        VectorXd getSolution();
+};
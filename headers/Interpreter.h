@@ -11,21 +11,26 @@ class Interpreter {
     private:
         Problem *pli;
         int mode;
-        MatrixXd constraints;
-        VectorXd objectiveFunction;
-        VectorXd relations;
-        ifstream in;
+        long long bytes;
+        long long lines;
+        long long nonzeros;
+        double objectiveOffset;
+        int chunks;
+        double readTime;
+        double parseTime;
 
-        void readFile();
-        void getObjectiveAndMode(string line);
-        bool getConstraint(string line);
-        void readLPFile();
-        bool getLPConstraint(string line);
-        bool getLPBound(string line);
-        void getLPObjectiveAndMode(string line);
+        void parse(const string &fileName, const char *begin, const char *end, int numberOfThreads);
 
     public:
-        Interpreter(const string fileName);
+        Interpreter(const string fileName, int numberOfThreads = 1);
+        ~Interpreter();
         Problem* getProblem();
         int getMode();
+        long long getBytes();
+        long long getLines();
+        long long getNonzeros();
+        double getObjectiveOffset();
+        int getChunks();
+        double getReadTime();
+        double getParseTime();
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Problem.h"
+#include "Limits.h"
+
+using namespace Eigen;
+using namespace std;
+
+#define SIMPLEX_MINIMIZE 1
+#define SIMPLEX_MAXIMIZE 2
+
+#define FIRST_PHASE 1
+#define SECOND_PHASE 2
+
+#define TABLEAU_ENGINE 1
+#define REVISED_ENGINE 2
+
+//retorno do teste da razão quando a variável que entra apenas troca de limite
+#define BOUND_FLIP -2
+
+//situação da última resolução do PL
+#define LP_OPTIMAL 1
+#define LP_INFEASIBLE 2
+#define LP_UNBOUNDED 3
+#define LP_INTERRUPTED 4
+
+/**
+ * Interface comum aos métodos de resolução de Programação Linear (Simplex tableau e Simplex revisado)
+ */
+class LPSolver {
+    protected:
+        //orçamento compartilhado da resolução (NULL sem limites)
+        Limits *limits;
+        int status;
+
+        void isValidEntry(int mode, Problem *problem);
+        double adjustPrecision(double value);
+        bool isInterrupted();
+
+    public:
+        virtual ~LPSolver() {}
+        virtual bool hasSolution() = 0;
+        virtual double getOptimum() = 0;
+        virtual VectorXd getSolution() = 0;
+        virtual LPSolver* clone() = 0;
+        virtual long long getIterations() = 0;
+        virtual void addConstraints(const vector<SparseVector<double> > &constraints, int relation) = 0;
+        virtual void setBounds(long long variable, double lower, double upper) = 0;
+        virtual bool reoptimize() = 0;
+        virtual bool dualReoptimize(long long iterationLimit) = 0;
+        virtual double getObjectiveValue() = 0;
+        virtual VectorXd getReducedCosts() = 0;
+        int getStatus();
+
+        static LPSolver* create(int engine, int mode, Problem *problem, Limits *limits = NULL);
+};
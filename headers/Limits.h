@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+//limite desligado
+#define NO_LIMIT -1
+
+//motivo da interrupção da busca
+#define NOT_REACHED 0
+#define TIME_LIMIT 1
+#define NODE_LIMIT 2
+#define ITERATION_LIMIT 3
+#define MEMORY_LIMIT 4
+#define CANCELLED 5
+
+//situação do resultado de um método
+#define OPTIMAL 1
+#define INFEASIBLE 2
+#define UNBOUNDED 3
+#define LIMIT_REACHED 4
+//o método parou sem provar a otimalidade (planos de corte sem cortes violados)
+#define STALLED 5
+
+/**
+ * Orçamento de uma resolução (tempo de relógio, nós, pivôs e memória de nós) e ficha de
+ * cancelamento cooperativo. É compartilhado pelas threads e pelos PLs da resolução: os laços
+ * de pivôs e de nós consultam o orçamento e param assim que algum limite é atingido, deixando
+ * o melhor resultado conhecido até ali. Um orçamento pode ter um pai (o do portfólio): os nós e
+ * pivôs contam também no pai, e parar o pai para todos os filhos.
+ */
+class Limits {
+    private:
+        double timeLimit;
+        long long nodeLimit;
+        long long iterationLimit;
+        long long memoryLimit;
+        chrono::steady_clock::time_point start;
+        atomic<long long> nodes;
+        atomic<long long> iterations;
+        atomic<int> reason;
+        Limits *parent;
+
+        void stop(int reason);
+
+    public:
+        Limits(double timeLimit = NO_LIMIT, long long nodeLimit = NO_LIMIT, long long iterationLimit = NO_LIMIT,
+            long long memoryLimit = NO_LIMIT, Limits *parent = NULL);
+        void cancel();
+        bool isReached();
+        bool addIteration();
+        bool addNode();
+        bool checkMemory(long long bytes);
+        int getReason();
+        long long getNodes();
+        long long getIterations();
+        double getElapsedTime();
+};
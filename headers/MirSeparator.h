@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Separator.h"
+
+using namespace Eigen;
+using namespace std;
+
+//divisores testados em cada linha (coeficientes das variáveis com valor positivo)
+#define MIR_DIVISORS 8
+//parte fracionária mínima do lado direito dividido para gerar o corte
+#define MIR_MIN_FRACTION 0.05
+
+/**
+ * Cortes de arredondamento inteiro misto (MIR) de cada restrição do problema: as variáveis são
+ * deslocadas para o limite mais próximo do ponto e a linha é dividida pelo divisor que dá o
+ * corte mais violado.
+ */
+class MirSeparator : public Separator {
+    protected:
+        void separate(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts);
+
+    public:
+        MirSeparator(Problem *ilp);
+};
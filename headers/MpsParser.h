@@ -0,0 +1,91 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Problem.h"
+#include "SymbolTable.h"
+#include <Eigen>
+
+using namespace Eigen;
+using namespace std;
+
+//variantes do formato MPS
+#define MPS_FREE 1
+#define MPS_FIXED 2
+
+//seções do formato MPS
+#define MPS_NO_SECTION 0
+#define MPS_ROWS 1
+#define MPS_COLUMNS 2
+#define MPS_RHS 3
+#define MPS_RANGES 4
+#define MPS_BOUNDS 5
+#define MPS_OBJSENSE 6
+
+//linha do objetivo e linhas livres (N) que não são a primeira
+#define MPS_OBJECTIVE_ROW -1
+#define MPS_FREE_ROW -2
+
+//valores a partir deste são infinitos (convenção do MPS)
+#define MPS_INFINITY 1e30
+
+/**
+ * Leitor do formato MPS (livre ou fixo): ROWS, COLUMNS (com MARKER INTORG/INTEND), RHS, RANGES,
+ * BOUNDS e OBJSENSE. Como o Parser, percorre o conteúdo em memória uma vez e guarda os coeficientes
+ * como triplas; as linhas com RANGES viram duas restrições (Problem tem uma relação por linha).
+ * No formato livre os campos são separados por espaços; no fixo ficam nas colunas padrão
+ * (2-3, 5-12, 15-22, 25-36, 40-47, 50-61), então os nomes podem ter espaços.
+ */
+class MpsParser {
+    private:
+        const char *current;
+        const char *end;
+        int format;
+        int mode;
+        long long line;
+        int section;
+        //campos da linha atual (header: a linha começa uma seção)
+        bool header;
+        vector<pair<const char*, const char*> > fields;
+        //nome da linha -> restrição (ou MPS_OBJECTIVE_ROW/MPS_FREE_ROW), pelo identificador do símbolo
+        SymbolTable rowNames;
+        vector<long long> rowIndices;
+        SymbolTable columns;
+        bool hasObjective;
+        vector<Triplet<double> > coefficients;
+        vector<pair<long long, double> > objective;
+        vector<int> relations;
+        vector<double> rightHandSides;
+        vector<double> ranges;
+        vector<double> lowerBounds;
+        vector<double> upperBounds;
+        vector<bool> lowerDefined;
+        double objectiveOffset;
+        bool integerMarker;
+        //integralidade por coluna; sem MARKER nem limites inteiros, todas as colunas são inteiras
+        vector<int> variableTypes;
+        bool hasIntegrality;
+
+        bool readLine();
+        void splitFree(const char *lineStart, const char *lineEnd);
+        void splitFixed(const char *lineStart, const char *lineEnd);
+        void readHeader();
+        void readRow();
+        void readColumn();
+        void readRightHandSide(bool range);
+        void readBound();
+        void readSense(const string &sense);
+        long long findRow(long long field);
+        long long findColumn(long long field);
+        double readValue(long long field);
+        string getField(long long field);
+        void error(const string &detail);
+
+    public:
+        MpsParser(const char *begin, const char *end, int format);
+        Problem* getProblem();
+        int getMode();
+        long long getLines();
+        long long getNonzeros();
+        double getObjectiveOffset();
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <fstream>
+#include "Problem.h"
+#include <Eigen>
+
+using namespace Eigen;
+using namespace std;
+
+/**
+ * Escritor do formato MPS livre: grava o Problem (objetivo, restrições, limites e a constante do
+ * objetivo como RHS da linha do objetivo) para ser lido de volta pelo MpsParser ou por outros
+ * resolvedores. Os números usam a menor precisão que volta ao mesmo double.
+ */
+class MpsWriter {
+    private:
+        Problem *problem;
+        int mode;
+        double objectiveOffset;
+
+        string formatNumber(double value);
+
+    public:
+        MpsWriter(Problem *problem, int mode, double objectiveOffset = 0);
+        void write(const string fileName);
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include "Problem.h"
+#include "SymbolTable.h"
+#include <Eigen>
+
+using namespace Eigen;
+using namespace std;
+
+//formatos de entrada
+#define FREE_FORMAT 1
+#define LP_FORMAT 2
+
+//seções do formato lp
+#define OBJECTIVE_SECTION 1
+#define CONSTRAINTS_SECTION 2
+#define BOUNDS_SECTION 3
+#define GENERALS_SECTION 4
+#define BINARIES_SECTION 5
+#define END_SECTION 6
+
+//tamanho típico de um termo ("+ 12.5x345 "), usado para reservar as triplas
+#define PARSER_BYTES_PER_COEFFICIENT 12
+
+//tamanho mínimo de cada bloco de restrições interpretado por uma thread
+#define PARSER_MIN_CHUNK_BYTES (1 << 20)
+
+/**
+ * Leitor de uma passada: percorre o conteúdo do arquivo, já carregado em memória, uma única vez,
+ * sem copiar linhas nem tokens, e guarda os coeficientes como triplas. A matriz de restrições é
+ * montada de uma só vez no fim (getProblem), então o tempo é linear no tamanho do arquivo.
+ *
+ * Com várias threads, a seção de restrições é dividida em blocos que terminam no fim de uma
+ * restrição; cada bloco é interpretado por um Parser próprio e as triplas são juntadas em ordem.
+ *
+ * As variáveis podem ter qualquer nome do formato lp (letras, dígitos e !"#$%&()/,.;?@_`'{}|~, sem
+ * começar por dígito ou ponto) e recebem colunas na ordem em que aparecem, pela tabela de símbolos.
+ * Se todos os nomes são x<índice>, a coluna continua sendo o índice.
+ *
+ * Formato livre: "Max Z = 5x1 + 9x2" na primeira linha e uma restrição por linha.
+ * Formato lp: Maximize/Minimize, objetivo, Subject To, Bounds, Generals, Binaries e End; expressões
+ * podem ocupar várias linhas e '\' inicia um comentário até o fim da linha. Sem nenhuma variável
+ * listada em Generals ou Binaries, todas são inteiras; com alguma listada, as demais são contínuas.
+ */
+class Parser {
+    private:
+        const char *current;
+        const char *end;
+        int format;
+        int numberOfThreads;
+        int numberOfChunks;
+        bool failed;
+        int mode;
+        long long line;
+        SymbolTable symbols;
+        vector<Triplet<double> > coefficients;
+        vector<pair<long long, double> > objective;
+        vector<int> relations;
+        vector<double> rightHandSides;
+        vector<double> lowerBounds;
+        vector<double> upperBounds;
+        vector<int> variableTypes;
+        bool hasIntegrality;
+
+        void parseFreeFormat();
+        void parseLPFormat();
+        void parseConstraint(bool lineBased);
+        bool parseConstraintsInParallel(bool lineBased);
+        void parseChunk(const char *begin, const char *end, bool lineBased);
+        const char* findConstraintsEnd();
+        const char* findChunkEnd(const char *position, const char *regionEnd, bool lineBased);
+        static bool endsConstraint(const char *begin, const char *lineEnd);
+        static void runBlocks(const vector<long long> &blocks, const function<void(long long, long long)> &work);
+        void parseBound();
+        void parseVariableType(int type);
+        void readExpression(long long row, bool lineBased);
+        int readRelation(bool lineBased);
+        double readValue(bool lineBased);
+        long long readVariable();
+        bool isVariable();
+        static bool isNameCharacter(char character);
+        static bool isNumberedName(const string &name, long long &index);
+        void readLabel();
+        int readSection();
+        bool readKeyword(const char *keyword);
+        bool skipBlank(bool newLines);
+        void expectLineEnd();
+        void setBound(long long column, int relation, double value);
+        void error();
+
+        explicit Parser(int format);
+
+    public:
+        Parser(const char *begin, const char *end, int format, int numberOfThreads = 1);
+        static bool readNumber(const char *&current, const char *end, double &value);
+        static SparseMatrixXd buildConstraints(vector<Triplet<double> > &coefficients, const vector<double> &rightHandSides,
+            long long numberOfVariables, int numberOfThreads = 1);
+        Problem* getProblem();
+        int getMode();
+        long long getLines();
+        long long getNonzeros();
+        int getChunks();
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include "BranchBound.h"
+#include "CuttingPlane.h"
+#include "Incumbent.h"
+#include "Limits.h"
+#include "Problem.h"
+#include <Eigen>
+
+//estratégias do portfólio por padrão
+#define PORTFOLIO_STRATEGIES 4
+//distância entre as sementes das heurísticas de duas estratégias
+#define PORTFOLIO_SEED_STEP 100
+
+//métodos de uma estratégia
+#define BRANCH_AND_BOUND_METHOD 1
+#define CUTTING_PLANE_METHOD 2
+
+using namespace std;
+
+/**
+ * Estratégia do portfólio: um método com a sua configuração, o seu orçamento (filho do
+ * orçamento do portfólio) e o resultado ao terminar
+ */
+struct Strategy {
+    string name;
+    int method;
+    int nodeSelection;
+    int branching;
+    int cuts;
+    int seed;
+    Limits *limits;
+    BranchBound *bb;
+    CuttingPlane *cp;
+    int status;
+    //tempo de relógio até a estratégia terminar, em segundos
+    double time;
+};
+
+/**
+ * Portfólio: resolve o mesmo problema com várias estratégias ao mesmo tempo, uma por thread.
+ * Os branch-and-bounds trocam incumbentes; a primeira estratégia que prova o resultado (ótimo,
+ * inviável ou ilimitado) vence e cancela as outras, então o tempo acompanha a estratégia mais
+ * rápida de cada instância. Sem vencedor, o resultado é o melhor incumbente com o melhor limite dual.
+ */
+class Portfolio {
+    private:
+        Problem *ilp;
+        int mode;
+        int engine;
+        bool useHeuristics;
+        bool usePropagation;
+        long long cutDepth;
+        long long cutRounds;
+        double relativeGap;
+        double absoluteGap;
+        Limits *limits;
+        Incumbent *incumbent;
+        vector<Strategy*> strategies;
+        atomic<int> winner;
+        int status;
+        double dualBound;
+
+        void createStrategies(int numberOfStrategies, int nodeSelection, int branching, int cuts);
+        void addStrategy(int method, int nodeSelection, int branching, int cuts, int seed);
+        void run(int index);
+        void collect();
+        bool isBetterBound(double first, double second);
+
+    public:
+        Portfolio(Problem *ilp, int mode, int numberOfStrategies = PORTFOLIO_STRATEGIES, int engine = TABLEAU_ENGINE,
+            int nodeSelection = BEST_BOUND, int branching = RELIABILITY, bool useHeuristics = true, int cuts = ROOT_CUTS,
+            long long cutDepth = CUT_MAX_DEPTH, long long cutRounds = CUT_ROOT_ROUNDS, bool usePropagation = true,
+            double relativeGap = DEFAULT_RELATIVE_GAP, double absoluteGap = DEFAULT_ABSOLUTE_GAP, Limits *limits = NULL);
+        ~Portfolio();
+        bool hasSolution();
+        int getStatus();
+        double getOptimum();
+        VectorXd getSolution();
+        double getDualBound();
+        double getGap();
+        Strategy* getWinner();
+        vector<Strategy*> getStrategies();
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include <map>
+#include <set>
+#include "Problem.h"
+
+using namespace Eigen;
+using namespace std;
+
+#define MINIMIZE 1
+#define MAXIMIZE 2
+
+//passadas máximas pelas reduções (cada passada pode habilitar novas reduções)
+#define PRESOLVE_PASSES 20
+//tolerância das comparações do presolve
+#define PRESOLVE_TOLERANCE 1e-9
+//folga para declarar o problema inviável (os erros de arredondamento das reduções se acumulam)
+#define PRESOLVE_FEASIBILITY_TOLERANCE 1e-6
+//folga no arredondamento dos limites de variáveis inteiras
+#define PRESOLVE_INTEGER_TOLERANCE 1e-6
+
+//operações desfeitas pelo postsolve
+#define FIXED_COLUMN 1
+#define SUBSTITUTED_COLUMN 2
+#define MERGED_COLUMNS 3
+
+/**
+ * Operação do presolve que o postsolve desfaz (na ordem inversa)
+ */
+struct PostsolveStep {
+    int type;
+    long long column;
+    //coluna usada na substituição ou coluna que recebeu a soma das duplicadas
+    long long other;
+    //FIXED_COLUMN: valor; SUBSTITUTED_COLUMN: column = value - coefficient * other
+    double value;
+    double coefficient;
+    //MERGED_COLUMNS: limites originais das duas colunas (other e column)
+    double otherLower;
+    double otherUpper;
+    double columnLower;
+    double columnUpper;
+};
+
+/**
+ * Presolve: reduz o problema antes de qualquer PL (linhas vazias, unitárias, redundantes,
+ * duplicadas e duplas de igualdade, colunas fixas, vazias, dominadas e duplicadas, aperto de
+ * limites e de coeficientes) e guarda as operações para o postsolve levar a solução do problema
+ * reduzido de volta às variáveis originais.
+ */
+class Presolve {
+    private:
+        Problem *original;
+        Problem *reduced;
+        int mode;
+        bool infeasible;
+        long long numberOfVariables;
+        long long numberOfRows;
+        //linhas como intervalos: rowLower <= a.x <= rowUpper
+        vector<map<long long, double> > rows;
+        vector<double> rowLower;
+        vector<double> rowUpper;
+        vector<bool> rowActive;
+        //linhas de cada coluna
+        vector<set<long long> > columns;
+        vector<bool> columnActive;
+        VectorXd objectiveFunction;
+        VectorXd lowerBounds;
+        VectorXd upperBounds;
+        double offset;
+        vector<PostsolveStep> steps;
+        //coluna original de cada coluna do problema reduzido (-1 para a coluna artificial)
+        vector<long long> columnMap;
+        //sinal da coluna reduzida na coluna original (-1 para colunas negadas e para x- das livres)
+        vector<int> columnSigns;
+        long long tightenedBounds;
+        long long tightenedCoefficients;
+
+        void loadProblem();
+        void buildProblem();
+        bool presolveRows();
+        bool presolveRow(long long row);
+        bool presolveColumns();
+        bool removeDuplicateRows();
+        bool removeDuplicateColumns();
+        bool tightenCoefficients(long long row);
+        bool substituteDoubleton(long long row);
+        bool fixColumn(long long column, double value);
+        bool setColumnBounds(long long column, double lower, double upper);
+        void setCoefficient(long long row, long long column, double value);
+        void removeRow(long long row);
+        void getActivity(long long row, long long skip, double &minimum, double &maximum, long long &minimumInfinite, long long &maximumInfinite);
+        double getCost(long long column);
+        bool isInteger(long long column);
+
+    public:
+        Presolve(Problem *ilp, int mode, bool enabled = true);
+        ~Presolve();
+        Problem* getProblem();
+        bool isInfeasible();
+        double getObjectiveOffset();
+        VectorXd postsolve(const VectorXd &solution);
+        long long getOriginalRows();
+        long long getOriginalColumns();
+        long long getReducedRows();
+        long long getReducedColumns();
+        long long getTightenedBounds();
+        long long getTightenedCoefficients();
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Eigen>
+#include <random>
+#include <chrono>
+#include "LPSolver.h"
+#include "Problem.h"
+#include "Limits.h"
+
+using namespace Eigen;
+using namespace std;
+
+//tolerância de integralidade e de viabilidade das soluções construídas
+#define HEURISTIC_TOLERANCE 1e-6
+//tentativas do arredondamento aleatório
+#define ROUNDING_TRIALS 20
+//tempo máximo de um mergulho (ms)
+#define DIVING_TIME_LIMIT 50
+//tempo máximo da feasibility pump (ms)
+#define PUMP_TIME_LIMIT 200
+//resoluções de PL da feasibility pump
+#define PUMP_ITERATIONS 30
+//variáveis perturbadas quando a feasibility pump entra em ciclo
+#define PUMP_FLIPS 10
+
+/**
+ * Heurísticas primais: constroem soluções inteiras viáveis a partir da relaxação de um nó.
+ * Cada chamada guarda a melhor solução que encontrou (ver getSolution/getOptimum).
+ */
+class PrimalHeuristics {
+    private:
+        Problem *ilp;
+        int mode;
+        int engine;
+        //orçamento da resolução (NULL sem limites)
+        Limits *limits;
+        long long numberOfVariables;
+        mt19937 generator;
+        chrono::steady_clock::time_point deadline;
+        bool foundSolution;
+        double optimum;
+        VectorXd solution;
+
+        void start(long long timeLimit);
+        bool isTimeOver();
+        bool isFeasible(const VectorXd &values);
+        bool isIntegral(const VectorXd &values);
+        bool isBetter(double value, double reference);
+        VectorXd roundValues(const VectorXd &values, const VectorXd &lower, const VectorXd &upper);
+        bool submit(const VectorXd &values);
+        LPSolver* solveDistance(const VectorXd &rounded, const VectorXd &values, const VectorXd &lower, const VectorXd &upper);
+
+    public:
+        PrimalHeuristics(Problem *ilp, int mode, int engine, unsigned int seed, Limits *limits = NULL);
+        bool rounding(const VectorXd &values, const VectorXd &lower, const VectorXd &upper);
+        bool diving(LPSolver *solver, const VectorXd &lower, const VectorXd &upper, const VectorXd &incumbent, double cutoff);
+        bool feasibilityPump(LPSolver *solver, const VectorXd &lower, const VectorXd &upper);
+        bool hasSolution();
+        double getOptimum();
+        VectorXd getSolution();
+};
@@ -1,19 +1,48 @@
 #pragma once
 
 #include <Eigen>
+#include <string>
+#include <vector>
 
 using namespace Eigen;
+using namespace std;
+
+//matriz esparsa armazenada por linhas (cada linha é uma restrição)
+typedef SparseMatrix<double, RowMajor> SparseMatrixXd;
+
+//integralidade das variáveis
+#define CONTINUOUS_VARIABLE 0
+#define GENERAL_VARIABLE 1
+#define BINARY_VARIABLE 2
 
 class Problem {
      private:
-         MatrixXd constraints;
+         SparseMatrixXd constraints;
          VectorXd objectiveFunction;
          VectorXd relations;
+         VectorXd lowerBounds;
+         VectorXd upperBounds;
+         vector<string> variableNames;
+         vector<int> variableTypes;
+         //colunas livres divididas em x+ - x-: a outra parte de cada coluna (vazio: nenhuma)
+         vector<long long> splitPartners;
 
      public:
-         Problem(const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations);
+         Problem(const VectorXd &objectiveFunction, const SparseMatrixXd &constraints, const VectorXd &relations);
+         Problem(const VectorXd &objectiveFunction, SparseMatrixXd &&constraints, const VectorXd &relations);
          VectorXd getObjectiveFunction();
          VectorXd getRelations();
-         MatrixXd getConstraints();
-         bool addConstraint(VectorXd constraint, int relation);
+         const SparseMatrixXd& getConstraints();
+         VectorXd getLowerBounds();
+         VectorXd getUpperBounds();
+         void setBounds(long long variable, double lower, double upper);
+         void setVariableNames(const vector<string> &variableNames);
+         const vector<string>& getVariableNames();
+         string getVariableName(long long variable);
+         void setVariableType(long long variable, int type);
+         int getVariableType(long long variable);
+         bool isInteger(long long variable);
+         bool hasContinuousVariables();
+         void setSplitPartner(long long variable, long long partner);
+         long long getSplitPartner(long long variable);
 };
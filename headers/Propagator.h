@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "Problem.h"
+
+using namespace Eigen;
+using namespace std;
+
+//passadas máximas da propagação em cada nó
+#define PROPAGATION_PASSES 10
+//tolerância das comparações de atividade
+#define PROPAGATION_TOLERANCE 1e-9
+//folga no arredondamento dos limites de variáveis inteiras
+#define PROPAGATION_INTEGER_TOLERANCE 1e-6
+//melhora mínima, relativa ao intervalo, para aceitar um limite novo de variável contínua
+#define PROPAGATION_MIN_IMPROVEMENT 1e-3
+
+/**
+ * Propagação de domínios: aperta os limites das variáveis pela atividade mínima e máxima das
+ * restrições (com arredondamento das variáveis inteiras) e detecta limites conflitantes.
+ * As linhas são apenas lidas, então uma instância é compartilhada por todas as threads.
+ */
+class Propagator {
+    private:
+        long long numberOfVariables;
+        long long numberOfRows;
+        //linhas como intervalos: rowLower <= a.x <= rowUpper
+        vector<vector<pair<long long, double> > > rows;
+        vector<double> rowLower;
+        vector<double> rowUpper;
+        //linhas de cada coluna
+        vector<vector<long long> > columns;
+        //integralidade de cada coluna
+        vector<bool> integers;
+
+        bool propagateRow(long long row, VectorXd &lower, VectorXd &upper, vector<long long> &changed, long long &tightened);
+        bool tightenLower(long long column, double value, VectorXd &lower, VectorXd &upper);
+        bool tightenUpper(long long column, double value, VectorXd &lower, VectorXd &upper);
+        bool isInteger(long long column);
+
+    public:
+        Propagator(Problem *ilp);
+        bool propagate(VectorXd &lower, VectorXd &upper, const vector<long long> &changed, long long &tightened);
+};
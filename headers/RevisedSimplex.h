@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "LPSolver.h"
+
+using namespace Eigen;
+using namespace std;
+
+//número de atualizações da base antes de refatorar
+#define REFACTOR_FREQUENCY 64
+//pivôs degenerados seguidos antes de aplicar Bland Rule
+#define DEGENERATE_LIMIT 50
+
+#define PIVOT_TOLERANCE 1e-9
+#define OPTIMALITY_TOLERANCE 1e-9
+#define FEASIBILITY_TOLERANCE 1e-7
+
+/**
+ * Matriz eta da forma produto da inversa: coluna 'row' substituída pela coluna de entrada
+ */
+struct EtaMatrix {
+    long long row;
+    double pivot;
+    SparseVector<double> column;
+};
+
+/**
+ * Simplex revisado: mantém a base fatorada (LU com atualizações na forma produto)
+ * e calcula apenas os custos reduzidos e a coluna de entrada a cada pivô
+ */
+class RevisedSimplex : public LPSolver {
+    private:
+        SparseMatrix<double> columns;
+        VectorXd cost;
+        VectorXd rhs;
+        VectorXd objectiveFunction;
+        VectorXd basicValues;
+        VectorXd lowerBounds;
+        VectorXd upperBounds;
+        vector<bool> atUpper;
+        vector<long long> basis;
+        vector<long long> position;
+        vector<EtaMatrix> etas;
+        SparseLU<SparseMatrix<double>, COLAMDOrdering<int> > lu;
+        long long numberOfVariables;
+        long long numberOfRows;
+        long long firstArtificial;
+        long long lastArtificial;
+        long long iterations;
+        bool foundSolution;
+        double optimum;
+        VectorXd solution;
+
+        bool simplexSolver(int phase);
+        bool dualSimplexSolver(long long iterationLimit = -1);
+        bool isArtificial(long long column);
+        long long findEnteringColumn(const VectorXd &dual, const VectorXd &phaseCost, int phase, bool bland);
+        long long findPivot(const VectorXd &column, double direction, double range, bool bland, double &step, bool &toUpper);
+        void pivot(long long pivotRow, long long enteringColumn, const VectorXd &column, double delta, bool leavingAtUpper);
+        double getNonbasicValue(long long column);
+        void removeArtificials();
+        void refactor();
+        VectorXd ftran(const VectorXd &column);
+        VectorXd btran(const VectorXd &row);
+        VectorXd getPhaseCost(int phase);
+        int buildColumns(Problem *problem);
+        void searchSolution();
+
+    public:
+        RevisedSimplex(int mode, Problem *problem, Limits *limits = NULL);
+        RevisedSimplex(const RevisedSimplex &other);
+        bool hasSolution();
+        double getOptimum();
+        VectorXd getSolution();
+        long long getIterations();
+        LPSolver* clone();
+        void addConstraints(const vector<SparseVector<double> > &constraints, int relation);
+        void setBounds(long long variable, double lower, double upper);
+        bool reoptimize();
+        bool dualReoptimize(long long iterationLimit);
+        double getObjectiveValue();
+        VectorXd getReducedCosts();
+};
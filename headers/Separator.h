@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include <string>
+#include "LPSolver.h"
+#include "Problem.h"
+
+using namespace Eigen;
+using namespace std;
+
+//violação mínima para um separador devolver um corte
+#define SEPARATION_TOLERANCE 1e-6
+
+/**
+ * Separador de uma família de cortes. Os cortes são devolvidos nas variáveis originais
+ * no formato a.x >= b (último coeficiente é o lado direito), e cada separador acumula as
+ * suas estatísticas: cortes encontrados, cortes aplicados, melhora do limite e tempo.
+ */
+class Separator {
+    protected:
+        Problem *ilp;
+        long long numberOfVariables;
+        string name;
+        //restrições do problema escritas como a.x <= b (igualdades viram duas linhas)
+        vector<SparseVector<double> > rows;
+        vector<double> rowsRhs;
+        VectorXd lowerBounds;
+        VectorXd upperBounds;
+        long long foundCuts;
+        long long appliedCuts;
+        double boundImprovement;
+        double time;
+
+        virtual void separate(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts) = 0;
+        SparseVector<double> makeCut(const VectorXd &coefficients, double rhs);
+        bool isBinary(long long variable);
+        bool getKnapsack(long long row, vector<long long> &variables, vector<double> &weights, vector<bool> &complemented, double &capacity);
+
+    public:
+        Separator(Problem *ilp, string name);
+        virtual ~Separator() {}
+        virtual bool isLocal();
+        void run(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts);
+        void registerApplied(long long cuts);
+        void registerImprovement(double improvement);
+        string getName();
+        long long getFoundCuts();
+        long long getAppliedCuts();
+        double getBoundImprovement();
+        double getTime();
+
+        static vector<Separator*> create(Problem *ilp);
+};
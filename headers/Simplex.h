@@ -1,46 +1,70 @@
 #pragma once
 
 #include <Eigen>
+#include <vector>
+#include "LPSolver.h"
 
 using namespace Eigen;
+using namespace std;
 
-#define SIMPLEX_MINIMIZE 1
-#define SIMPLEX_MAXIMIZE 2
+//pivôs degenerados seguidos antes de aplicar Bland Rule
+#define TABLEAU_DEGENERATE_LIMIT 20
+//distância de um inteiro abaixo da qual um coeficiente de folga é considerado inteiro
+#define INTEGER_COEFFICIENT_TOLERANCE 1e-9
 
-#define FIRST_PHASE 1
-#define SECOND_PHASE 2
 
-class Simplex {
+class Simplex : public LPSolver {
     private:
         MatrixXd tableau;
+        int mode;
         bool foundSolution;
         double optimum;
         VectorXd solution;
         long long numberOfVariables;
+        long long iterations;
+        vector<long long> basis;
+        VectorXd lowerBounds;
+        VectorXd upperBounds;
+        vector<bool> complemented;
+        //integralidade de cada variável do problema
+        vector<bool> integers;
+        //folga de cada coluna depois das variáveis: folga = definição . [x; 1]
+        vector<SparseVector<double> > slackDefinitions;
+        //corte que criou cada coluna de folga (-1 para restrições)
+        vector<long long> slackIds;
 
-        bool simplexSolver(long long  variableNum, int mode, int phase);
-        long long findPivot(long long column, int phase, bool bland);
-        long long getPivotRow(long long column);
+        bool simplexSolver(int mode, int phase);
+        bool dualSimplexSolver(long long iterationLimit = -1);
+        void pivot(long long pivotRow, long long pivotColumn);
+        long long findPivot(long long column, int phase, bool bland, bool &toUpper);
+        double getRange(long long column);
+        void complementColumn(long long column);
+        void complementRow(long long row);
+        void removeArtificials(int numberOfArtificials);
         void removeRow(long long rowToRemove);
         void removeColumn(long long colToRemove);
-        void isValidEntry(int mode, const VectorXd &objectiveFunction,
-            const MatrixXd &constraints, const VectorXd &relations);
         void searchSolution();
-        int buildTableau(int mode, const VectorXd &objectiveFunction,
-            const MatrixXd &constraints, const VectorXd &relations);
-        int buildTableauWithCuts(int mode, const VectorXd &objectiveFunction,
-            const MatrixXd &constraints, const VectorXd &relations,
-            const MatrixXd &cuts);
-        double adjustPrecision(double value);
+        void fillRow(long long row, double sign, const SparseMatrixXd &constraints, long long constraint);
+        int buildTableau(Problem *problem);
+        void addSlackDefinition(const SparseVector<double> &constraint, double sign, long long id);
 
     public:
-        Simplex(int mode, const VectorXd &objectiveFunction,
-            const MatrixXd &constraints, const VectorXd &relations);
-        Simplex(int mode, const VectorXd &objectiveFunction,
-            const MatrixXd &constraints, const VectorXd &relations,
-            const MatrixXd &cuts);
+        Simplex(int mode, Problem *problem, Limits *limits = NULL);
         bool hasSolution();
         double getOptimum();
         VectorXd getSolution();
         MatrixXd getTableau();
+        long long getIterations();
+        LPSolver* clone();
+        void addConstraint(const SparseVector<double> &constraint, int relation);
+        void addConstraints(const vector<SparseVector<double> > &constraints, int relation);
+        void setBounds(long long variable, double lower, double upper);
+        bool reoptimize();
+        bool dualReoptimize(long long iterationLimit);
+        double getObjectiveValue();
+        VectorXd getReducedCosts();
+        SparseVector<double> getOriginalCut(const VectorXd &cut);
+        void addCut(const SparseVector<double> &cut, long long id);
+        bool removeCut(long long id);
+        bool isIntegerColumn(long long column);
 };
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Problem.h"
+#include <Eigen>
+
+using namespace Eigen;
+using namespace std;
+
+//identificação e versão do formato binário
+#define SNAPSHOT_MAGIC "ILPSNAP"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+//alinhamento de cada seção no arquivo
+#define SNAPSHOT_ALIGNMENT 8
+
+/**
+ * Cabeçalho do snapshot: todos os campos têm 8 bytes (sem preenchimento entre eles) e as seções
+ * são indicadas pelo deslocamento a partir do início do arquivo.
+ */
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    int64_t mode;
+    int64_t rows;
+    int64_t columns;
+    int64_t nonzeros;
+    double objectiveOffset;
+    uint64_t objective;
+    uint64_t lowerBounds;
+    uint64_t upperBounds;
+    uint64_t relations;
+    uint64_t outerIndex;
+    uint64_t innerIndex;
+    uint64_t values;
+    uint64_t integers;
+    uint64_t nameOffsets;
+    uint64_t names;
+    uint64_t size;
+};
+
+/**
+ * Snapshot binário de um Problem, para recarregar um modelo já interpretado sem ler o texto de novo.
+ * As seções guardam os vetores como estão na memória: objetivo e limites (double por coluna),
+ * relações (int32 por linha), a matriz comprimida por linhas exatamente como a do Eigen (índices
+ * int32 e valores double, com o lado direito na última coluna), a integralidade (um byte por coluna:
+ * CONTINUOUS_VARIABLE, GENERAL_VARIABLE ou BINARY_VARIABLE)
+ * e os nomes das variáveis. Carregar é copiar cada seção do arquivo mapeado, sem interpretação.
+ */
+class Snapshot {
+    private:
+        Problem *problem;
+        int mode;
+        long long nonzeros;
+        double objectiveOffset;
+        vector<int> variableTypes;
+        vector<string> names;
+
+        static uint64_t align(uint64_t position);
+        static void error(const string &detail);
+
+    public:
+        Snapshot(const char *begin, const char *end);
+        static bool isSnapshot(const char *begin, const char *end);
+        static void write(const string fileName, Problem *problem, int mode, double objectiveOffset = 0);
+        Problem* getProblem();
+        int getMode();
+        long long getNonzeros();
+        double getObjectiveOffset();
+        const vector<int>& getVariableTypes();
+        const vector<string>& getNames();
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+//tamanho inicial da tabela de espalhamento (potência de 2)
+#define SYMBOL_TABLE_INITIAL_SLOTS 1024
+
+/**
+ * Tabela de símbolos: cada nome distinto recebe um identificador denso (0, 1, 2, ... na ordem em
+ * que aparece pela primeira vez) que não muda mais. Os nomes ficam concatenados em um único
+ * bloco de caracteres e a busca é por endereçamento aberto sobre o próprio trecho do texto, sem
+ * criar strings, então cada consulta custa O(1) mesmo com milhões de ocorrências.
+ */
+class SymbolTable {
+    private:
+        string characters;
+        vector<size_t> offsets;
+        vector<uint64_t> hashes;
+        //espaços da tabela de espalhamento: (espalhamento, identificador), -1 se vazio
+        vector<pair<uint64_t, long long> > slots;
+
+        static uint64_t hash(const char *begin, const char *end);
+        long long findSlot(const char *begin, const char *end, uint64_t code);
+        void grow();
+
+    public:
+        SymbolTable();
+        long long intern(const char *begin, const char *end);
+        long long find(const char *begin, const char *end);
+        long long size();
+        string getName(long long id);
+};
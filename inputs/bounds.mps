@@ -0,0 +1,14 @@
+NAME          BOUNDS
+ROWS
+ N  obj
+ L  c1
+COLUMNS
+    x1        obj       -1   c1        1
+    x2        obj       -1   c1        1
+RHS
+    rhs       c1        10
+BOUNDS
+ up bnd       x1        2
+ Lo bnd       x2        -1
+ uP bnd       x2        3
+ENDATA
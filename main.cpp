@@ -1,17 +1,123 @@
 #include "headers/Interpreter.h"
 #include "headers/BranchBound.h"
 #include "headers/CuttingPlane.h"
+#include "headers/Presolve.h"
+#include "headers/Portfolio.h"
+#include "headers/MpsWriter.h"
+#include "headers/Snapshot.h"
+#include "headers/Batch.h"
 #include "headers/Exception.h"
-#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <csignal>
+#include <fstream>
 
 using namespace std;
 
+//orçamento do método em execução, cancelado pelo Ctrl+C
+static atomic<Limits *> running(NULL);
+
+/**
+ * @desc Tratador do SIGINT: pede o cancelamento cooperativo do método em execução, que para
+ * @desc no próximo pivô ou nó e mostra o melhor resultado encontrado até ali
+ *
+ * @param int sinal recebido (sempre SIGINT)
+ * @returns void
+ */
+void cancelSolve(int) {
+    Limits *limits = running.load();
+    if (limits != NULL) {
+        limits->cancel();
+    }
+}
+
+/**
+ * @desc Libera o orçamento de um método que terminou. O SIGINT fica bloqueado enquanto o
+ * @desc orçamento deixa de ser o cancelado pelo Ctrl+C e é liberado, assim o tratador nunca
+ * @desc usa um orçamento já liberado
+ *
+ * @param Limits *limits orçamento a liberar (pode ser NULL)
+ * @returns void
+ */
+void releaseLimits(Limits *limits) {
+    sigset_t interrupt, previous;
+    sigemptyset(&interrupt);
+    sigaddset(&interrupt, SIGINT);
+    sigprocmask(SIG_BLOCK, &interrupt, &previous);
+    running = NULL;
+    delete limits;
+    sigprocmask(SIG_SETMASK, &previous, NULL);
+}
+
+/**
+ * @desc Nome da situação do resultado de um método, com o motivo da parada quando um limite foi atingido
+ *
+ * @param int status situação retornada pelo método
+ * @param Limits *limits orçamento do método
+ * @returns string
+ */
+string getStatusName(int status, Limits *limits) {
+    switch (status) {
+        case OPTIMAL:
+            return "otimo";
+        case INFEASIBLE:
+            return "inviavel";
+        case UNBOUNDED:
+            return "ilimitado";
+        case STALLED:
+            return "parado sem cortes violados";
+    }
+    switch (limits->getReason()) {
+        case TIME_LIMIT:
+            return "limite de tempo atingido";
+        case NODE_LIMIT:
+            return "limite de nos atingido";
+        case ITERATION_LIMIT:
+            return "limite de iteracoes atingido";
+        case MEMORY_LIMIT:
+            return "limite de memoria atingido";
+        case CANCELLED:
+            return "cancelado";
+    }
+    return "limite atingido";
+}
+
 int main(int argc, char* argv[]) {
 
     BranchBound *bb = NULL;
     CuttingPlane *cp = NULL;
     Interpreter *interpreter = NULL;
-    clock_t time[2];
+    Presolve *presolve = NULL;
+    Portfolio *portfolio = NULL;
+    Batch *batch = NULL;
+    Limits *limits = NULL;
+    Problem *problem;
+    //tempo de relógio: com várias threads o tempo de CPU somado não bate com o --time-limit
+    chrono::steady_clock::time_point time[2];
+    int engine = TABLEAU_ENGINE;
+    int nodeSelection = BEST_BOUND;
+    int numberOfThreads = 1;
+    int parseThreads = 0;
+    int branching = RELIABILITY;
+    bool useHeuristics = true;
+    bool usePresolve = true;
+    bool usePropagation = true;
+    double relativeGap = DEFAULT_RELATIVE_GAP;
+    double absoluteGap = DEFAULT_ABSOLUTE_GAP;
+    double timeLimit = NO_LIMIT;
+    long long nodeLimit = NO_LIMIT;
+    long long iterationLimit = NO_LIMIT;
+    long long memoryLimit = NO_LIMIT;
+    int cuts = ROOT_CUTS;
+    long long cutDepth = CUT_MAX_DEPTH;
+    long long cutRounds = CUT_ROOT_ROUNDS;
+    int numberOfStrategies = 0;
+    string mpsFileName;
+    string snapshotFileName;
+    int batchFormat = 0;
+    int batchThreads = 0;
+    string outputFileName;
 
     try {
 
@@ -19,48 +125,308 @@ int main(int argc, char* argv[]) {
             throw(new Exception("Digite o nome do arquivo de entrada!"));
         }
 
-        interpreter = new Interpreter(argv[1]);
+        //opções: --engine=tableau|revised --node-selection=best-bound|depth-first|best-estimate|hybrid --threads=N
+        //        --branching=most-fractional|pseudocost|strong|reliability --heuristics=on|off
+        //        --cuts=off|root|tree --cut-depth=N --cut-rounds=N --presolve=on|off --propagation=on|off
+        //        --gap=R --abs-gap=A --time-limit=S --node-limit=N --iteration-limit=N --memory-limit=MB
+        //        --portfolio=on|off|N --write-mps=FILE --write-snapshot=FILE
+        //        --parse-threads=N --batch=csv|json --batch-threads=N --output=FILE
+        for (int i = 2; i < argc; i++) {
+            string option = argv[i];
+            if (option == "--engine=tableau") {
+                engine = TABLEAU_ENGINE;
+            } else if (option == "--engine=revised") {
+                engine = REVISED_ENGINE;
+            } else if (option == "--node-selection=best-bound") {
+                nodeSelection = BEST_BOUND;
+            } else if (option == "--node-selection=depth-first") {
+                nodeSelection = DEPTH_FIRST;
+            } else if (option == "--node-selection=best-estimate") {
+                nodeSelection = BEST_ESTIMATE;
+            } else if (option == "--node-selection=hybrid") {
+                nodeSelection = HYBRID;
+            } else if (option == "--branching=most-fractional") {
+                branching = MOST_FRACTIONAL;
+            } else if (option == "--branching=pseudocost") {
+                branching = PSEUDOCOST;
+            } else if (option == "--branching=strong") {
+                branching = STRONG_BRANCHING;
+            } else if (option == "--branching=reliability") {
+                branching = RELIABILITY;
+            } else if (option == "--heuristics=on") {
+                useHeuristics = true;
+            } else if (option == "--heuristics=off") {
+                useHeuristics = false;
+            } else if (option == "--presolve=on") {
+                usePresolve = true;
+            } else if (option == "--presolve=off") {
+                usePresolve = false;
+            } else if (option == "--propagation=on") {
+                usePropagation = true;
+            } else if (option == "--propagation=off") {
+                usePropagation = false;
+            } else if (option == "--cuts=off") {
+                cuts = NO_CUTS;
+            } else if (option == "--cuts=root") {
+                cuts = ROOT_CUTS;
+            } else if (option == "--cuts=tree") {
+                cuts = TREE_CUTS;
+            } else if (option.compare(0, 12, "--cut-depth=") == 0 && atoi(option.substr(12).c_str()) >= 0) {
+                cutDepth = atoi(option.substr(12).c_str());
+            } else if (option.compare(0, 13, "--cut-rounds=") == 0 && atoi(option.substr(13).c_str()) >= 0) {
+                cutRounds = atoi(option.substr(13).c_str());
+            } else if (option.compare(0, 6, "--gap=") == 0 && atof(option.substr(6).c_str()) >= 0) {
+                relativeGap = atof(option.substr(6).c_str());
+            } else if (option.compare(0, 10, "--abs-gap=") == 0 && atof(option.substr(10).c_str()) >= 0) {
+                absoluteGap = atof(option.substr(10).c_str());
+            } else if (option.compare(0, 13, "--time-limit=") == 0 && atof(option.substr(13).c_str()) >= 0) {
+                timeLimit = atof(option.substr(13).c_str());
+            } else if (option.compare(0, 13, "--node-limit=") == 0 && atoll(option.substr(13).c_str()) >= 0) {
+                nodeLimit = atoll(option.substr(13).c_str());
+            } else if (option.compare(0, 18, "--iteration-limit=") == 0 && atoll(option.substr(18).c_str()) >= 0) {
+                iterationLimit = atoll(option.substr(18).c_str());
+            } else if (option.compare(0, 15, "--memory-limit=") == 0 && atoll(option.substr(15).c_str()) >= 0) {
+                memoryLimit = atoll(option.substr(15).c_str()) * 1024 * 1024;
+            } else if (option == "--portfolio=on") {
+                numberOfStrategies = PORTFOLIO_STRATEGIES;
+            } else if (option == "--portfolio=off") {
+                numberOfStrategies = 0;
+            } else if (option.compare(0, 12, "--portfolio=") == 0 && atoi(option.substr(12).c_str()) > 0) {
+                numberOfStrategies = atoi(option.substr(12).c_str());
+            } else if (option.compare(0, 10, "--threads=") == 0 && atoi(option.substr(10).c_str()) > 0) {
+                numberOfThreads = atoi(option.substr(10).c_str());
+            } else if (option.compare(0, 16, "--parse-threads=") == 0 && atoi(option.substr(16).c_str()) >= 0) {
+                parseThreads = atoi(option.substr(16).c_str());
+            } else if (option.compare(0, 12, "--write-mps=") == 0 && option.length() > 12) {
+                mpsFileName = option.substr(12);
+            } else if (option.compare(0, 17, "--write-snapshot=") == 0 && option.length() > 17) {
+                snapshotFileName = option.substr(17);
+            } else if (option == "--batch=csv") {
+                batchFormat = CSV_RESULTS;
+            } else if (option == "--batch=json") {
+                batchFormat = JSON_RESULTS;
+            } else if (option.compare(0, 16, "--batch-threads=") == 0 && atoi(option.substr(16).c_str()) >= 0) {
+                batchThreads = atoi(option.substr(16).c_str());
+            } else if (option.compare(0, 9, "--output=") == 0 && option.length() > 9) {
+                outputFileName = option.substr(9);
+            } else {
+                throw(new Exception("Opcao invalida: " + option));
+            }
+        }
 
-        time[0] = clock();
+        //lote: o argumento é um diretório ou manifesto e os resultados saem em CSV ou JSON
+        if (batchFormat != 0) {
+            if (numberOfStrategies > 0 || !mpsFileName.empty() || !snapshotFileName.empty()) {
+                throw(new Exception("As opcoes --portfolio, --write-mps e --write-snapshot nao valem no modo em lote!"));
+            }
+            vector<string> fileNames = Batch::readInstances(argv[1]);
 
-        bb = new BranchBound(interpreter->getProblem(), interpreter->getMode());
+            signal(SIGINT, cancelSolve);
+            running = limits = new Limits();
+            batch = new Batch(fileNames, batchThreads, engine, nodeSelection, numberOfThreads, branching, useHeuristics, cuts,
+                cutDepth, cutRounds, usePresolve, usePropagation, relativeGap, absoluteGap, timeLimit, nodeLimit,
+                iterationLimit, memoryLimit, limits);
 
-        time[1] = clock();
+            //sem --output os resultados vão para a saída padrão, sem o resumo
+            if (outputFileName.empty()) {
+                batch->write(cout, batchFormat);
+            } else {
+                ofstream output(outputFileName.c_str());
+                if (!output.is_open()) {
+                    throw(new Exception("Nao foi possivel criar o arquivo " + outputFileName + "!"));
+                }
+                batch->write(output, batchFormat);
+                cout << "----------Lote---------" << endl;
+                cout << "Instancias: " << fileNames.size() << endl;
+                cout << "Resolvidas: " << batch->getSolved() << endl;
+                cout << "Erros: " << batch->getErrors() << endl;
+                cout << "Tempo: " << limits->getElapsedTime() * 1000 << "ms" << endl;
+                cout << "Resultados escritos em " << outputFileName << endl;
+            }
+            delete batch;
+            releaseLimits(limits);
+            return 0;
+        }
 
-        double totalTime = (time[1] - time[0]) * 1000.00 / CLOCKS_PER_SEC;
+        interpreter = new Interpreter(argv[1], parseThreads);
 
-        cout << "----------Branch and Bound---------" << endl;
-        if (bb->hasSolution()) {
-            cout << "Valor otimizado: " << bb->getOptimum() << endl;
-            cout << "Solucao: [" << bb->getSolution().transpose() << "]"<< endl;
-            cout << "Tempo: " << totalTime << "ms" << endl;
-        } else {
-            cout << "Solucao nao encontrada" << endl;
+        cout << "----------Leitura---------" << endl;
+        cout << "Linhas: " << interpreter->getLines() << endl;
+        cout << "Coeficientes: " << interpreter->getNonzeros() << endl;
+        if (interpreter->getChunks() > 1) {
+            cout << "Blocos em paralelo: " << interpreter->getChunks() << endl;
         }
+        cout << "Tempo: " << interpreter->getReadTime() + interpreter->getParseTime() << "ms (arquivo "
+             << interpreter->getReadTime() << "ms, interpretacao " << interpreter->getParseTime() << "ms)" << endl;
+        cout << "Vazao: " << interpreter->getBytes() / 1000.0 / max(interpreter->getParseTime(), 1e-6) << " MB/s" << endl;
 
-        time[0] = clock();
+        //conversão: grava o problema lido, antes do presolve, e não resolve
+        if (!mpsFileName.empty() || !snapshotFileName.empty()) {
+            if (!mpsFileName.empty()) {
+                MpsWriter writer(interpreter->getProblem(), interpreter->getMode(), interpreter->getObjectiveOffset());
+                writer.write(mpsFileName);
+                cout << "Problema escrito em " << mpsFileName << endl;
+            }
+            if (!snapshotFileName.empty()) {
+                Snapshot::write(snapshotFileName, interpreter->getProblem(), interpreter->getMode(),
+                    interpreter->getObjectiveOffset());
+                cout << "Snapshot escrito em " << snapshotFileName << endl;
+            }
+            delete interpreter;
+            return 0;
+        }
 
-        cp = new CuttingPlane(interpreter->getProblem(), interpreter->getMode());
+        time[0] = chrono::steady_clock::now();
 
-        time[1] = clock();
+        //o presolve fica entre o Interpreter e os métodos, que só veem o problema reduzido
+        presolve = new Presolve(interpreter->getProblem(), interpreter->getMode(), usePresolve);
+        problem = presolve->getProblem();
+        double offset = presolve->getObjectiveOffset() + interpreter->getObjectiveOffset();
 
-        totalTime = (time[1] - time[0]) * 1000.00 / CLOCKS_PER_SEC;
+        time[1] = chrono::steady_clock::now();
 
-        cout << "----------Planos de Corte---------" << endl;
-        if (cp->hasSolution()) {
-            cout << "Valor otimizado: " << cp->getOptimum() << endl;
-            cout << "Solucao: [" << cp->getSolution().transpose() << "]"<< endl;
-            cout << "Tempo: " << totalTime << "ms" << endl;
+        if (usePresolve) {
+            cout << "----------Presolve---------" << endl;
+            cout << "Restricoes: " << presolve->getOriginalRows() << " -> " << presolve->getReducedRows() << endl;
+            cout << "Variaveis: " << presolve->getOriginalColumns() << " -> " << presolve->getReducedColumns() << endl;
+            cout << "Limites apertados: " << presolve->getTightenedBounds() << endl;
+            cout << "Coeficientes apertados: " << presolve->getTightenedCoefficients() << endl;
+            if (presolve->isInfeasible()) {
+                cout << "Problema inviavel" << endl;
+            }
+            cout << "Tempo: " << chrono::duration<double, milli>(time[1] - time[0]).count() << "ms" << endl;
+        }
+
+        signal(SIGINT, cancelSolve);
+
+        //portfólio: as estratégias correm juntas e só o resultado da mais rápida interessa
+        if (numberOfStrategies > 0) {
+            running = limits = new Limits(timeLimit, nodeLimit, iterationLimit, memoryLimit);
+            portfolio = new Portfolio(problem, interpreter->getMode(), numberOfStrategies, engine, nodeSelection, branching,
+                useHeuristics, cuts, cutDepth, cutRounds, usePropagation, relativeGap, absoluteGap, limits);
+
+            cout << "----------Portfolio---------" << endl;
+            cout << "Situacao: " << getStatusName(portfolio->getStatus(), limits) << endl;
+            if (portfolio->getWinner() != NULL) {
+                cout << "Estrategia vencedora: " << portfolio->getWinner()->name << endl;
+            }
+            if (portfolio->hasSolution()) {
+                cout << "Valor otimizado: " << portfolio->getOptimum() + offset << endl;
+                cout << "Solucao: [" << presolve->postsolve(portfolio->getSolution()).transpose() << "]"<< endl;
+                cout << "Limite dual: " << portfolio->getDualBound() + offset << endl;
+                cout << "Gap: " << portfolio->getGap() * 100 << "%" << endl;
+            } else {
+                cout << "Solucao nao encontrada" << endl;
+                if (portfolio->getStatus() == LIMIT_REACHED || portfolio->getStatus() == STALLED) {
+                    cout << "Limite dual: " << portfolio->getDualBound() + offset << endl;
+                }
+            }
+            vector<Strategy*> strategies = portfolio->getStrategies();
+            for (size_t i = 0; i < strategies.size(); i++) {
+                cout << "  " << strategies[i]->name << ": " << getStatusName(strategies[i]->status, strategies[i]->limits);
+                if (strategies[i]->bb != NULL) {
+                    cout << ", nos " << strategies[i]->bb->getNumberOfNodes()
+                         << ", incumbentes importados " << strategies[i]->bb->getImportedSolutions();
+                } else {
+                    cout << ", rodadas de cortes " << strategies[i]->cp->getRounds();
+                }
+                cout << ", tempo " << strategies[i]->time * 1000 << "ms" << endl;
+            }
+            cout << "Tempo: " << limits->getElapsedTime() * 1000 << "ms" << endl;
         } else {
-            cout << "Solucao nao encontrada" << endl;
+            time[0] = chrono::steady_clock::now();
+
+            //cada método recebe o orçamento inteiro
+            running = limits = new Limits(timeLimit, nodeLimit, iterationLimit, memoryLimit);
+            bb = new BranchBound(problem, interpreter->getMode(), engine, nodeSelection, numberOfThreads, branching, useHeuristics,
+                cuts, cutDepth, cutRounds, usePropagation, relativeGap, absoluteGap, limits);
+
+            time[1] = chrono::steady_clock::now();
+
+            double totalTime = chrono::duration<double, milli>(time[1] - time[0]).count();
+
+            cout << "----------Branch and Bound---------" << endl;
+            cout << "Situacao: " << getStatusName(bb->getStatus(), limits) << endl;
+            if (bb->hasSolution()) {
+                cout << "Valor otimizado: " << bb->getOptimum() + offset << endl;
+                cout << "Solucao: [" << presolve->postsolve(bb->getSolution()).transpose() << "]"<< endl;
+                cout << "Limite dual: " << bb->getDualBound() + offset << endl;
+                cout << "Gap: " << bb->getGap() * 100 << "%" << endl;
+                cout << "Nos explorados: " << bb->getNumberOfNodes() << endl;
+                cout << "Memoria de nos (pico): " << bb->getPeakNodeMemory() << " bytes" << endl;
+                cout << "Solucoes das heuristicas: " << bb->getHeuristicSolutions() << endl;
+                if (cuts != NO_CUTS) {
+                    cout << "Limite da raiz: " << bb->getRootBound() + offset << " -> " << bb->getCutBound() + offset << " (com cortes)" << endl;
+                    cout << "Cortes aplicados: " << bb->getAppliedCuts() << " (globais no pool: " << bb->getPoolSize() << ")" << endl;
+                }
+                if (usePropagation) {
+                    cout << "Limites apertados nos nos: " << bb->getPropagatedBounds() << " (propagacao), "
+                        << bb->getFixedBounds() << " (custo reduzido)" << endl;
+                    cout << "Nos podados pela propagacao: " << bb->getPrunedNodes() << endl;
+                }
+                if (numberOfThreads > 1) {
+                    cout << "Nos por thread:";
+                    vector<long long> nodesPerThread = bb->getNodesPerThread();
+                    for (size_t i = 0; i < nodesPerThread.size(); i++) {
+                        cout << " " << nodesPerThread[i];
+                    }
+                    cout << endl;
+                }
+                cout << "Tempo: " << totalTime << "ms" << endl;
+            } else {
+                cout << "Solucao nao encontrada" << endl;
+                if (bb->getStatus() == LIMIT_REACHED) {
+                    cout << "Limite dual: " << bb->getDualBound() + offset << endl;
+                    cout << "Nos explorados: " << bb->getNumberOfNodes() << endl;
+                    cout << "Tempo: " << totalTime << "ms" << endl;
+                }
+            }
+
+            time[0] = chrono::steady_clock::now();
+
+            releaseLimits(limits);
+            running = limits = new Limits(timeLimit, nodeLimit, iterationLimit, memoryLimit);
+            cp = new CuttingPlane(problem, interpreter->getMode(), limits);
+
+            time[1] = chrono::steady_clock::now();
+
+            totalTime = chrono::duration<double, milli>(time[1] - time[0]).count();
+
+            cout << "----------Planos de Corte---------" << endl;
+            cout << "Situacao: " << getStatusName(cp->getStatus(), limits) << endl;
+            if (cp->hasSolution()) {
+                cout << "Valor otimizado: " << cp->getOptimum() + offset << endl;
+                cout << "Solucao: [" << presolve->postsolve(cp->getSolution()).transpose() << "]"<< endl;
+                cout << "Rodadas de cortes: " << cp->getRounds() << endl;
+                cout << "Cortes aplicados: " << cp->getAppliedCuts() << endl;
+                vector<Separator*> separators = cp->getSeparators();
+                for (size_t i = 0; i < separators.size(); i++) {
+                    cout << "  " << separators[i]->getName() << ": encontrados " << separators[i]->getFoundCuts()
+                         << ", aplicados " << separators[i]->getAppliedCuts()
+                         << ", melhora do limite " << separators[i]->getBoundImprovement()
+                         << ", tempo " << separators[i]->getTime() << "ms" << endl;
+                }
+                cout << "Tempo: " << totalTime << "ms" << endl;
+            } else {
+                cout << "Solucao nao encontrada" << endl;
+                if (cp->getStatus() == LIMIT_REACHED || cp->getStatus() == STALLED) {
+                    cout << "Limite dual: " << cp->getDualBound() + offset << endl;
+                    cout << "Rodadas de cortes: " << cp->getRounds() << endl;
+                    cout << "Tempo: " << totalTime << "ms" << endl;
+                }
+            }
         }
 
     } catch (Exception *ex) {
         ex->print();
     }
 
+    delete batch;
+    delete portfolio;
     delete bb;
     delete cp;
+    releaseLimits(limits);
+    delete presolve;
     delete interpreter;
 
     return 0;
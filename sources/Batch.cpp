@@ -0,0 +1,431 @@
+#include "../headers/Batch.h"
+#include "../headers/Interpreter.h"
+#include "../headers/Presolve.h"
+#include "../headers/Exception.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+#include <thread>
+#include <dirent.h>
+#include <sys/stat.h>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: coloca as instâncias na fila, resolve-as com um conjunto fixo de threads e
+ * @desc espera todas terminarem
+ *
+ * @param const vector<string> &fileNames arquivos das instâncias, na ordem dos resultados
+ * @param int numberOfWorkers threads do lote (0 para uma por núcleo)
+ * @param int engine método de resolução das relaxações: TABLEAU_ENGINE, REVISED_ENGINE
+ * @param int nodeSelection política de seleção de nós
+ * @param int numberOfThreads threads do branch-and-bound de cada instância
+ * @param int branching regra de ramificação
+ * @param bool useHeuristics true para executar as heurísticas primais
+ * @param int cuts separação de cortes: NO_CUTS, ROOT_CUTS, TREE_CUTS
+ * @param long long cutDepth profundidade máxima dos nós com separação (TREE_CUTS)
+ * @param long long cutRounds rodadas de separação na raiz
+ * @param bool usePresolve true para reduzir cada instância antes de resolvê-la
+ * @param bool usePropagation true para propagar os limites nos nós
+ * @param double relativeGap gap relativo que encerra cada busca
+ * @param double absoluteGap gap absoluto que encerra cada busca
+ * @param double timeLimit tempo máximo de cada instância em segundos (NO_LIMIT sem limite)
+ * @param long long nodeLimit nós de cada instância (NO_LIMIT sem limite)
+ * @param long long iterationLimit pivôs de cada instância (NO_LIMIT sem limite)
+ * @param long long memoryLimit memória de nós de cada instância em bytes (NO_LIMIT sem limite)
+ * @param Limits *limits orçamento do lote, pai dos orçamentos das instâncias (NULL sem limites)
+ */
+Batch::Batch(const vector<string> &fileNames, int numberOfWorkers, int engine, int nodeSelection, int numberOfThreads,
+    int branching, bool useHeuristics, int cuts, long long cutDepth, long long cutRounds, bool usePresolve,
+    bool usePropagation, double relativeGap, double absoluteGap, double timeLimit, long long nodeLimit,
+    long long iterationLimit, long long memoryLimit, Limits *limits) {
+    vector<thread> threads;
+    BatchResult *result;
+
+    this->fileNames = fileNames;
+    this->next = 0;
+    this->engine = engine;
+    this->nodeSelection = nodeSelection;
+    this->numberOfThreads = numberOfThreads;
+    this->branching = branching;
+    this->useHeuristics = useHeuristics;
+    this->cuts = cuts;
+    this->cutDepth = cutDepth;
+    this->cutRounds = cutRounds;
+    this->usePresolve = usePresolve;
+    this->usePropagation = usePropagation;
+    this->relativeGap = relativeGap;
+    this->absoluteGap = absoluteGap;
+    this->timeLimit = timeLimit;
+    this->nodeLimit = nodeLimit;
+    this->iterationLimit = iterationLimit;
+    this->memoryLimit = memoryLimit;
+    this->limits = limits;
+
+    for(size_t i = 0; i < fileNames.size(); i++) {
+        result = new BatchResult();
+        result->fileName = fileNames[i];
+        result->status = BATCH_ERROR;
+        result->reason = NOT_REACHED;
+        result->foundSolution = false;
+        result->optimum = 0;
+        result->nodes = 0;
+        result->iterations = 0;
+        result->time = 0;
+        this->results.push_back(result);
+    }
+
+    if(numberOfWorkers < 1) {
+        numberOfWorkers = max((int) thread::hardware_concurrency(), 1);
+    }
+    numberOfWorkers = (int) min((long long) numberOfWorkers, (long long) fileNames.size());
+
+    for(int i = 0; i < numberOfWorkers; i++) {
+        threads.push_back(thread(&Batch::run, this));
+    }
+    for(size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+/**
+ * @desc Destrutor: libera os resultados
+ */
+Batch::~Batch() {
+    for(size_t i = 0; i < this->results.size(); i++) {
+        delete this->results[i];
+    }
+}
+
+/**
+ * @desc Laço de uma thread do lote: retira a próxima instância da fila até ela acabar
+ *
+ * @returns void
+ */
+void Batch::run() {
+    long long index;
+
+    while((index = this->next++) < (long long) this->results.size()) {
+        this->solve(this->results[index]);
+    }
+}
+
+/**
+ * @desc Lê, reduz e resolve uma instância com o seu próprio orçamento. Um erro de leitura ou de
+ * @desc resolução fica no resultado da instância, sem interromper o lote.
+ *
+ * @param BatchResult *result recebe o resultado
+ * @returns void
+ */
+void Batch::solve(BatchResult *result) {
+    Limits *limits = new Limits(this->timeLimit, this->nodeLimit, this->iterationLimit, this->memoryLimit, this->limits);
+    Interpreter *interpreter = NULL;
+    Presolve *presolve = NULL;
+    BranchBound *bb = NULL;
+
+    //lote cancelado: as instâncias que faltam nem são lidas
+    if(limits->isReached()) {
+        result->status = LIMIT_REACHED;
+        result->reason = limits->getReason();
+        delete limits;
+        return;
+    }
+
+    try {
+        interpreter = new Interpreter(result->fileName, 1);
+        presolve = new Presolve(interpreter->getProblem(), interpreter->getMode(), this->usePresolve);
+        bb = new BranchBound(presolve->getProblem(), interpreter->getMode(), this->engine, this->nodeSelection,
+            this->numberOfThreads, this->branching, this->useHeuristics, this->cuts, this->cutDepth, this->cutRounds,
+            this->usePropagation, this->relativeGap, this->absoluteGap, limits);
+
+        result->status = bb->getStatus();
+        result->reason = limits->getReason();
+        result->nodes = bb->getNumberOfNodes();
+        if(bb->hasSolution()) {
+            result->foundSolution = true;
+            result->optimum = bb->getOptimum() + presolve->getObjectiveOffset() + interpreter->getObjectiveOffset();
+            result->solution = presolve->postsolve(bb->getSolution());
+        }
+    } catch(Exception *ex) {
+        result->status = BATCH_ERROR;
+        result->error = ex->getMessage();
+        delete ex;
+    }
+    result->iterations = limits->getIterations();
+    result->time = limits->getElapsedTime();
+
+    delete bb;
+    delete presolve;
+    delete interpreter;
+    delete limits;
+}
+
+/**
+ * @desc Lista as instâncias de um diretório (arquivos regulares não ocultos, em ordem de nome) ou
+ * @desc de um manifesto (um caminho por linha; linhas vazias e começadas por '#' são ignoradas e
+ * @desc caminhos relativos partem do diretório do manifesto)
+ *
+ * @param const string path diretório ou manifesto
+ * @returns vector<string>
+ */
+vector<string> Batch::readInstances(const string path) {
+    vector<string> fileNames;
+    struct stat status;
+    struct dirent *entry;
+    DIR *directory;
+    string name, line, base;
+    size_t first, last;
+
+    if(stat(path.c_str(), &status) != 0) {
+        throw(new Exception("Batch: Nao foi possivel abrir " + path + "!"));
+    }
+
+    if(S_ISDIR(status.st_mode)) {
+        directory = opendir(path.c_str());
+        if(directory == NULL) {
+            throw(new Exception("Batch: Nao foi possivel abrir o diretorio " + path + "!"));
+        }
+        base = (path[path.length()-1] == '/') ? path : path + "/";
+        while((entry = readdir(directory)) != NULL) {
+            name = entry->d_name;
+            if(name.empty() || name[0] == '.') {
+                continue;
+            }
+            if(stat((base + name).c_str(), &status) == 0 && S_ISREG(status.st_mode)) {
+                fileNames.push_back(base + name);
+            }
+        }
+        closedir(directory);
+        sort(fileNames.begin(), fileNames.end());
+    } else {
+        ifstream manifest(path.c_str());
+        if(!manifest.is_open()) {
+            throw(new Exception("Batch: Nao foi possivel abrir o manifesto " + path + "!"));
+        }
+        base = path.substr(0, path.find_last_of('/') + 1);
+        while(getline(manifest, line)) {
+            first = line.find_first_not_of(" \t\r");
+            if(first == string::npos || line[first] == '#') {
+                continue;
+            }
+            last = line.find_last_not_of(" \t\r");
+            name = line.substr(first, last - first + 1);
+            fileNames.push_back((name[0] == '/') ? name : base + name);
+        }
+    }
+
+    if(fileNames.empty()) {
+        throw(new Exception("Batch: Nenhuma instancia encontrada em " + path + "!"));
+    }
+    return fileNames;
+}
+
+/**
+ * @desc Escreve os resultados, na ordem de entrada
+ *
+ * @param ostream &output destino
+ * @param int format CSV_RESULTS ou JSON_RESULTS
+ * @returns void
+ */
+void Batch::write(ostream &output, int format) {
+    if(format == JSON_RESULTS) {
+        this->writeJson(output);
+    } else {
+        this->writeCsv(output);
+    }
+    output.flush();
+}
+
+/**
+ * @desc CSV com cabeçalho e uma linha por instância; a solução é um campo com os valores
+ * @desc separados por espaços e o valor fica vazio quando não há solução
+ *
+ * @param ostream &output
+ * @returns void
+ */
+void Batch::writeCsv(ostream &output) {
+    char time[32];
+    BatchResult *result;
+
+    output << "file,status,objective,nodes,pivots,time_ms,solution,error\n";
+    for(size_t i = 0; i < this->results.size(); i++) {
+        result = this->results[i];
+        snprintf(time, sizeof(time), "%.3f", result->time * 1000);
+        output << Batch::quoteCsv(result->fileName) << "," << Batch::getStatusName(result) << ",";
+        if(result->foundSolution) {
+            output << Batch::formatNumber(result->optimum);
+        }
+        output << "," << result->nodes << "," << result->iterations << "," << time << ",";
+        for(long long j = 0; result->foundSolution && j < result->solution.rows(); j++) {
+            output << ((j > 0) ? " " : "") << Batch::formatNumber(result->solution(j));
+        }
+        output << "," << Batch::quoteCsv(result->error) << "\n";
+    }
+}
+
+/**
+ * @desc JSON: uma lista com um objeto por instância; valor e solução são null quando não há solução
+ *
+ * @param ostream &output
+ * @returns void
+ */
+void Batch::writeJson(ostream &output) {
+    char time[32];
+    BatchResult *result;
+
+    output << "[";
+    for(size_t i = 0; i < this->results.size(); i++) {
+        result = this->results[i];
+        snprintf(time, sizeof(time), "%.3f", result->time * 1000);
+        output << ((i > 0) ? ",\n  " : "\n  ") << "{\"file\": " << Batch::quoteJson(result->fileName)
+               << ", \"status\": \"" << Batch::getStatusName(result) << "\", \"objective\": ";
+        if(result->foundSolution && std::isfinite(result->optimum)) {
+            output << Batch::formatNumber(result->optimum);
+        } else {
+            output << "null";
+        }
+        output << ", \"nodes\": " << result->nodes << ", \"pivots\": " << result->iterations << ", \"time_ms\": " << time
+               << ", \"solution\": ";
+        if(result->foundSolution) {
+            output << "[";
+            for(long long j = 0; j < result->solution.rows(); j++) {
+                output << ((j > 0) ? ", " : "") << (std::isfinite(result->solution(j)) ? Batch::formatNumber(result->solution(j)) : "null");
+            }
+            output << "]";
+        } else {
+            output << "null";
+        }
+        output << ", \"error\": " << (result->error.empty() ? "null" : Batch::quoteJson(result->error)) << "}";
+    }
+    output << "\n]\n";
+}
+
+/**
+ * @desc Nome da situação de uma instância nos resultados (com o motivo quando um limite foi atingido)
+ *
+ * @param BatchResult *result
+ * @returns string
+ */
+string Batch::getStatusName(BatchResult *result) {
+    switch(result->status) {
+        case BATCH_ERROR:
+            return "error";
+        case OPTIMAL:
+            return "optimal";
+        case INFEASIBLE:
+            return "infeasible";
+        case UNBOUNDED:
+            return "unbounded";
+    }
+    switch(result->reason) {
+        case TIME_LIMIT:
+            return "time_limit";
+        case NODE_LIMIT:
+            return "node_limit";
+        case ITERATION_LIMIT:
+            return "iteration_limit";
+        case MEMORY_LIMIT:
+            return "memory_limit";
+        case CANCELLED:
+            return "cancelled";
+    }
+    return "limit";
+}
+
+/**
+ * @desc Formata o número com 15 dígitos ou, se não voltar ao mesmo valor, com 17
+ *
+ * @param double value
+ * @returns string
+ */
+string Batch::formatNumber(double value) {
+    char buffer[32];
+
+    snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if(strtod(buffer, NULL) != value) {
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+    return buffer;
+}
+
+/**
+ * @desc Campo CSV: entre aspas (com as aspas dobradas) se tiver vírgula, aspas ou quebra de linha
+ *
+ * @param const string &text
+ * @returns string
+ */
+string Batch::quoteCsv(const string &text) {
+    string quoted = "\"";
+
+    if(text.find_first_of(",\"\r\n") == string::npos) {
+        return text;
+    }
+    for(size_t i = 0; i < text.length(); i++) {
+        quoted += (text[i] == '"') ? "\"\"" : string(1, text[i]);
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @desc Texto JSON entre aspas, com os caracteres de controle, aspas e barras escapados
+ *
+ * @param const string &text
+ * @returns string
+ */
+string Batch::quoteJson(const string &text) {
+    string quoted = "\"";
+    char buffer[8];
+
+    for(size_t i = 0; i < text.length(); i++) {
+        if(text[i] == '"' || text[i] == '\\') {
+            quoted += '\\';
+            quoted += text[i];
+        } else if((unsigned char) text[i] < 0x20) {
+            snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char) text[i]);
+            quoted += buffer;
+        } else {
+            quoted += text[i];
+        }
+    }
+    return quoted + "\"";
+}
+
+/**
+ * @desc Retorna os resultados, na ordem de entrada
+ *
+ * @returns vector<BatchResult*>
+ */
+vector<BatchResult*> Batch::getResults() {
+    return this->results;
+}
+
+/**
+ * @desc Retorna o número de instâncias com resultado provado (ótimo, inviável ou ilimitado)
+ *
+ * @returns long long
+ */
+long long Batch::getSolved() {
+    long long solved = 0;
+
+    for(size_t i = 0; i < this->results.size(); i++) {
+        solved += (this->results[i]->status == OPTIMAL || this->results[i]->status == INFEASIBLE
+            || this->results[i]->status == UNBOUNDED);
+    }
+    return solved;
+}
+
+/**
+ * @desc Retorna o número de instâncias que não puderam ser lidas ou resolvidas
+ *
+ * @returns long long
+ */
+long long Batch::getErrors() {
+    long long errors = 0;
+
+    for(size_t i = 0; i < this->results.size(); i++) {
+        errors += (this->results[i]->status == BATCH_ERROR);
+    }
+    return errors;
+}
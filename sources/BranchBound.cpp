@@ -2,6 +2,8 @@
 #include <Eigen>
 #include <cmath>
 #include <limits>
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -10,101 +12,1083 @@ using namespace Eigen;
  *
  * @param Problem *ilp problema de Programação Linear Inteira a ser resolvido pelo branch-and-bound.
  * @param int mode Pode ser: MINIMIZE, MAXIMIZE
+ * @param int engine método de resolução das relaxações: TABLEAU_ENGINE, REVISED_ENGINE
+ * @param int nodeSelection política de seleção de nós: BEST_BOUND, DEPTH_FIRST, BEST_ESTIMATE, HYBRID
+ * @param int numberOfThreads número de threads da busca
+ * @param int branching regra de ramificação: MOST_FRACTIONAL, PSEUDOCOST, STRONG_BRANCHING, RELIABILITY
+ * @param bool useHeuristics true para executar as heurísticas primais na raiz e durante a busca
+ * @param int cuts separação de cortes: NO_CUTS, ROOT_CUTS (apenas na raiz), TREE_CUTS (raiz e nós)
+ * @param long long cutDepth profundidade máxima dos nós com separação (TREE_CUTS)
+ * @param long long cutRounds rodadas de separação na raiz
+ * @param bool usePropagation true para propagar os limites e fixar variáveis por custo reduzido nos nós
+ * @param double relativeGap gap relativo entre o incumbente e o limite dual que encerra a busca
+ * @param double absoluteGap gap absoluto entre o incumbente e o limite dual que encerra a busca
+ * @param Limits *limits orçamento de tempo, nós, pivôs e memória, com a ficha de cancelamento (NULL sem limites)
+ * @param Incumbent *sharedIncumbent incumbente trocado com outros métodos em execução (NULL se não há)
+ * @param int seed semente das heurísticas primais (somada ao índice da thread)
  */
-BranchBound::BranchBound(Problem *ilp, int mode) {
+BranchBound::BranchBound(Problem *ilp, int mode, int engine, int nodeSelection, int numberOfThreads, int branching, bool useHeuristics,
+    int cuts, long long cutDepth, long long cutRounds, bool usePropagation, double relativeGap, double absoluteGap, Limits *limits,
+    Incumbent *sharedIncumbent, int seed) {
+    VectorXd objectiveFunction = ilp->getObjectiveFunction();
+
+    this->ilp = ilp;
+    this->rootSolver = NULL;
     this->mode = mode;
-    this->root = new Node();
-    this->root->ilp = ilp;
+    this->engine = engine;
+    this->nodeSelection = nodeSelection;
+    this->numberOfThreads = numberOfThreads;
+    this->branching = branching;
+    this->useHeuristics = useHeuristics;
+    this->usePropagation = usePropagation;
+    this->propagator = usePropagation ? new Propagator(ilp) : NULL;
+    this->propagatedBounds = 0;
+    this->fixedBounds = 0;
+    this->prunedNodes = 0;
+    this->relativeGap = relativeGap;
+    this->absoluteGap = absoluteGap;
+    this->gapClosed = false;
+    this->limits = limits;
+    this->status = INFEASIBLE;
+    //com custos inteiros só em variáveis inteiras o valor de qualquer solução é inteiro
+    this->integralObjective = true;
+    for(long long i = 0; i < objectiveFunction.rows(); i++) {
+        if(fabs(objectiveFunction(i) - round(objectiveFunction(i))) > PROPAGATION_TOLERANCE
+            || (objectiveFunction(i) != 0 && !ilp->isInteger(i))) {
+            this->integralObjective = false;
+        }
+    }
+    this->cuts = cuts;
+    this->cutDepth = cutDepth;
+    this->cutRounds = cutRounds;
+    this->cutPool = new CutPool(ilp->getObjectiveFunction().rows());
+    this->appliedCuts = 0;
+    this->rootBound = 0;
+    this->cutBound = 0;
+    this->heuristicSolutions = 0;
+    //a política híbrida mergulha em profundidade até encontrar a primeira solução inteira
+    this->diving = (nodeSelection == HYBRID);
+    this->pendingNodes = 0;
+    this->createdNodes = 0;
+    this->nodeMemory = 0;
+    this->peakNodeMemory = 0;
     this->foundSolution = false;
+    this->sharedIncumbent = sharedIncumbent;
+    this->sharedVersion = 0;
+    this->importedSolutions = 0;
+    for(int k = 0; k < 2; k++) {
+        this->pseudocostSum[k] = VectorXd::Zero(ilp->getObjectiveFunction().rows());
+        this->pseudocostCount[k].assign(ilp->getObjectiveFunction().rows(), 0);
+    }
     if(mode == MAXIMIZE) {
-        this->optimum = numeric_limits<double>::min();
+        this->optimum = numeric_limits<double>::lowest();
     } else {
         this->optimum = numeric_limits<double>::max();
     }
-    this->findSolutions(root);
+
+    for(int i = 0; i < numberOfThreads; i++) {
+        Worker *worker = new Worker();
+        worker->diving = this->diving;
+        worker->numberOfNodes = 0;
+        worker->lastSolver = NULL;
+        worker->lastId = -1;
+        worker->heuristics = new PrimalHeuristics(ilp, mode, engine, seed + i, limits);
+        if(cuts != NO_CUTS) {
+            worker->separators = Separator::create(ilp);
+        }
+        this->workers.push_back(worker);
+    }
+
+    this->findSolutions();
 }
 
 /**
- * @desc Busca por todas as soluções
+ * @desc Destrutor: libera a relaxação da raiz, as threads e os nós que ainda estiverem abertos
+ */
+BranchBound::~BranchBound() {
+    for(size_t k = 0; k < this->workers.size(); k++) {
+        for(size_t i = 0; i < this->workers[k]->openNodes.size(); i++) {
+            this->releaseNode(this->workers[k]->openNodes[i]);
+        }
+        delete this->workers[k]->lastSolver;
+        delete this->workers[k]->heuristics;
+        for(size_t i = 0; i < this->workers[k]->separators.size(); i++) {
+            delete this->workers[k]->separators[i];
+        }
+        delete this->workers[k];
+    }
+    delete this->rootSolver;
+    delete this->cutPool;
+    delete this->propagator;
+}
+
+/**
+ * @desc Busca por todas as soluções: resolve a raiz, fortalece a sua relaxação com cortes
+ * @desc (que todos os nós herdam) e distribui a árvore entre as threads. Ao final define a
+ * @desc situação: ótimo (árvore esgotada ou gap fechado), inviável, ilimitado ou limite atingido.
  *
- * @param Node node contém o problema a ser resolvido.
  * @returns void
  */
-void BranchBound::findSolutions(Node *node) {
-    //variável para verificar se a restrição foi adicionada
-    bool check;
+void BranchBound::findSolutions() {
+    vector<thread> threads;
+    Node *root;
 
-    node->solver = new Simplex(this->mode, node->ilp->getObjectiveFunction(), node->ilp->getConstraints(), node->ilp->getRelations());
+    //apenas a raiz é resolvida do zero, os outros nós partem de uma base ótima (ver solveNode)
+    this->rootSolver = LPSolver::create(this->engine, this->mode, this->ilp, this->limits);
+    if(!this->rootSolver->hasSolution()) {
+        if(this->rootSolver->getStatus() == LP_INTERRUPTED) {
+            this->status = LIMIT_REACHED;
+        } else if(this->rootSolver->getStatus() == LP_UNBOUNDED) {
+            this->status = UNBOUNDED;
+        }
+        return;
+    }
 
-    //verifica se o problema possui solução e se ela é melhor que a atual
-    if(node->solver->hasSolution() && this->isBetterSolution(node->solver->getOptimum())) {
+    this->importIncumbent();
 
-        //método de branch/ramificação
-        long long pos = this->findBranch(node->solver->getSolution());
+    root = new Node();
+    root->bound = this->rootSolver->getOptimum();
+    root->inherited = 0;
+    root->id = this->createdNodes++;
+    root->parentId = -1;
+    root->branchVariable = -1;
+    this->rootBound = this->rootSolver->getOptimum();
+    if(this->cuts != NO_CUTS) {
+        this->separateCuts(this->workers[0], root, this->rootSolver, this->cutRounds);
+        if(this->isLimitReached()) {
+            //a raiz fica aberta com o limite anterior aos cortes, que continua válido
+            this->pushNode(this->workers[0], root);
+            this->status = LIMIT_REACHED;
+            return;
+        }
+        if(!this->rootSolver->hasSolution()) {
+            delete root;
+            return;
+        }
+    }
+    this->cutBound = this->rootSolver->getOptimum();
 
-        if(pos != -1) {
-            double intPart, temp;
-            VectorXd newConstraint;
-            //busca a parte fracional do número
-            temp = node->solver->getSolution()(pos);
-            modf(temp, &intPart);
+    root->bound = this->rootSolver->getOptimum();
+    root->estimate = this->getEstimate(this->rootSolver);
+    this->pushNode(this->workers[0], root);
 
-            node->left = new Node();
-            node->left->ilp = new Problem(node->ilp->getObjectiveFunction(), node->ilp->getConstraints(), node->ilp->getRelations());
+    if(this->numberOfThreads == 1) {
+        this->work(0);
+    } else {
+        for(int i = 0; i < this->numberOfThreads; i++) {
+            threads.push_back(thread(&BranchBound::work, this, i));
+        }
+        for(int i = 0; i < this->numberOfThreads; i++) {
+            threads[i].join();
+        }
+    }
 
-            //cria uma nova restrição baseado no limite inferior
-            newConstraint = VectorXd::Zero(node->ilp->getConstraints().cols());
-            newConstraint(pos) = 1;
-            newConstraint(newConstraint.rows()-1) = intPart;
+    //nós que sobraram abertos sem o gap fechado: a busca foi interrompida por um limite
+    if(this->pendingNodes > 0 && !this->gapClosed) {
+        this->status = LIMIT_REACHED;
+    } else if(this->foundSolution) {
+        this->status = OPTIMAL;
+    }
+}
 
-            //caso a parte inteira seja 0 a relação é de igualdade
-            if(intPart == 0) {
-                check = node->left->ilp->addConstraint(newConstraint, 2);
-            } else {
-                check = node->left->ilp->addConstraint(newConstraint, 0);
+/**
+ * @desc Laço de uma thread: explora os nós da própria fila e, quando ela esvazia,
+ * @desc rouba nós das outras threads. Termina quando não há nós pendentes em nenhuma fila,
+ * @desc quando o gap entre o incumbente e o limite dual global fica dentro da tolerância ou
+ * @desc quando algum limite do orçamento é atingido (o nó em exploração volta para a fila).
+ *
+ * @param int workerId índice da thread
+ * @returns void
+ */
+void BranchBound::work(int workerId) {
+    Worker *worker = this->workers[workerId];
+    LPSolver *solver;
+    Node *node;
+    long long pos;
+
+    while(!this->gapClosed && !this->isLimitReached()) {
+        node = this->popNode(worker);
+        if(node == NULL) {
+            node = this->stealNode(workerId);
+        }
+        if(node == NULL) {
+            if(this->pendingNodes == 0) {
+                break;
             }
+            this_thread::yield();
+            continue;
+        }
 
-            if(check) {
-                this->findSolutions(node->left);
+        //o incumbente pode ter melhorado depois que o nó foi aberto (aqui ou em outro método)
+        this->importIncumbent();
+        if(this->isBetterSolution(this->roundBound(node->bound))) {
+            if(this->limits != NULL && this->limits->addNode()) {
+                this->requeueNode(worker, node);
+                break;
+            }
+            solver = this->solveNode(worker, node);
+            //PL interrompido: o nó continua aberto e o seu limite segue valendo para o limite dual
+            if(this->isLimitReached()) {
+                this->requeueNode(worker, node);
+                break;
             }
+            worker->numberOfNodes++;
 
-            node->right = new Node();
-            node->right->ilp = new Problem(node->ilp->getObjectiveFunction(), node->ilp->getConstraints(), node->ilp->getRelations());
+            //a degradação do valor em relação ao pai alimenta o pseudocusto da variável ramificada
+            if(node->branchVariable != -1 && solver->hasSolution()) {
+                this->updatePseudocost(node->branchVariable, node->branchUp, node->branchDistance,
+                    fabs(solver->getOptimum() - node->bound));
+            }
+
+            //separação nos nós até a profundidade limite (a raiz já foi separada em findSolutions)
+            if(this->cuts == TREE_CUTS && node->depth > 0 && node->depth <= this->cutDepth && solver->hasSolution()
+                && this->isBetterSolution(this->roundBound(solver->getOptimum())) && this->findBranch(solver->getSolution()) != -1) {
+                this->separateCuts(worker, node, solver, CUT_NODE_ROUNDS);
+                if(this->isLimitReached()) {
+                    this->requeueNode(worker, node);
+                    break;
+                }
+            }
 
-            //cria uma nova restrição baseado no limite superior
-            newConstraint(newConstraint.rows()-1) = intPart + 1;
-            check = node->right->ilp->addConstraint(newConstraint, 1);
+            //verifica se o problema possui solução e se ela é melhor que a atual
+            if(solver->hasSolution() && this->isBetterSolution(this->roundBound(solver->getOptimum()))) {
 
-            if(check) {
-                this->findSolutions(node->right);
+                //método de branch/ramificação
+                pos = this->selectBranch(node, solver);
+
+                if(pos == -1) {
+                    this->updateIncumbent(solver->getSolution(), solver->getOptimum(), false);
+                } else {
+                    this->runHeuristics(worker, node, solver);
+
+                    //um incumbente das heurísticas pode ter podado o próprio nó
+                    if(this->isBetterSolution(this->roundBound(solver->getOptimum()))) {
+                        this->branch(worker, node, solver, pos);
+                    }
+                }
             }
+        }
+
+        //o nó já foi explorado ou podado: apenas os filhos continuam na memória
+        this->releaseNode(node);
+
+        //os filhos já foram contados em pushNode, então o contador só zera no fim da busca
+        this->pendingNodes--;
+
+        //as outras threads param ao terminar o nó atual, deixando os nós restantes abertos
+        if(this->isGapClosed()) {
+            this->gapClosed = true;
+        }
+        if(this->limits != NULL) {
+            this->limits->checkMemory(this->nodeMemory);
+        }
+    }
+}
+
+/**
+ * @desc Reconstrói e resolve a relaxação do nó: se o pai foi o último nó explorado pela thread,
+ * @desc parte da sua base ótima e aplica apenas as alterações novas do nó; senão parte da raiz e
+ * @desc aplica todas, junto com os cortes do caminho. Em ambos os casos a reotimização é feita
+ * @desc com o Simplex dual.
+ *
+ * @param Worker *worker thread que explora o nó (guarda a relaxação para os filhos)
+ * @param Node *node nó a ser resolvido
+ * @returns LPSolver*
+ */
+LPSolver* BranchBound::solveNode(Worker *worker, Node *node) {
+    LPSolver *solver;
+    size_t first;
+
+    if(worker->lastSolver != NULL && worker->lastSolver->hasSolution() && node->parentId == worker->lastId) {
+        solver = worker->lastSolver->clone();
+        first = node->inherited;
+    } else {
+        solver = this->rootSolver->clone();
+        first = 0;
+        solver->addConstraints(node->cuts, 1);
+    }
+
+    for(size_t i = first; i < node->changes.size(); i++) {
+        solver->setBounds(node->changes[i].variable, node->changes[i].lower, node->changes[i].upper);
+    }
+    solver->reoptimize();
+
+    delete worker->lastSolver;
+    worker->lastSolver = solver;
+    worker->lastId = node->id;
+    return solver;
+}
+
+/**
+ * @desc Ramifica o nó na variável pos e coloca os dois filhos na fila. Com a propagação ligada,
+ * @desc os dois filhos recebem as fixações por custo reduzido do nó e têm a ramificação propagada
+ * @desc pelas restrições; um filho inviável pela propagação é podado sem resolver o seu PL.
+ *
+ * @param Worker *worker thread que ramifica o nó (recebe os filhos)
+ * @param Node *node nó a ser ramificado
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @param long long pos índice da variável fracionária
+ * @returns void
+ */
+void BranchBound::branch(Worker *worker, Node *node, LPSolver *solver, long long pos) {
+    double value = solver->getSolution()(pos);
+    double intPart = floor(value);
+    vector<BoundChange> fixings;
+    BoundChange change;
+    VectorXd lower, upper;
+    Node *children[2];
+    long long partner;
+
+    node->bound = solver->getOptimum();
+    node->estimate = this->getEstimate(solver);
+    this->getNodeBounds(node, lower, upper);
+    if(this->usePropagation) {
+        fixings = this->fixByReducedCost(solver, lower, upper);
+    }
+
+    //ramo esquerdo: x <= parte inteira; ramo direito: x >= parte inteira + 1
+    children[0] = this->createChild(node, fixings, pos, lower(pos), intPart, false, value - intPart);
+    children[1] = this->createChild(node, fixings, pos, intPart + 1, upper(pos), true, intPart + 1 - value);
+
+    //parte de uma variável livre (x = x+ - x-): com uma parte positiva a outra pode ser zero,
+    //senão as duas crescem juntas sem mudar x e a árvore não termina
+    partner = this->ilp->getSplitPartner(pos);
+    if(partner >= 0) {
+        change.variable = partner;
+        change.lower = lower(partner);
+        change.upper = 0;
+        children[1]->changes.push_back(change);
+    }
+
+    for(int k = 0; k < 2; k++) {
+        if(this->usePropagation && !this->propagateNode(children[k])) {
+            this->prunedNodes++;
+            delete children[k];
+            continue;
+        }
+        this->pushNode(worker, children[k]);
+    }
+}
+
+/**
+ * @desc Fixação por custo reduzido: uma variável não básica em um limite cujo custo reduzido
+ * @desc piora o valor da relaxação não pode se afastar desse limite mais do que a distância
+ * @desc entre a relaxação e o incumbente permite. Vale para toda a subárvore do nó.
+ *
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @param VectorXd &lower limites inferiores do nó (apertados no lugar)
+ * @param VectorXd &upper limites superiores do nó (apertados no lugar)
+ * @returns vector<BoundChange> limites alterados
+ */
+vector<BoundChange> BranchBound::fixByReducedCost(LPSolver *solver, VectorXd &lower, VectorXd &upper) {
+    vector<BoundChange> fixings;
+    VectorXd reducedCosts, values;
+    BoundChange change;
+    double incumbent, gap, range, sign;
+
+    {
+        lock_guard<mutex> guard(this->incumbentLock);
+        if(!this->foundSolution) {
+            return fixings;
+        }
+        incumbent = this->optimum;
+    }
+
+    //custo reduzido no sentido de minimização: positivo quando aumentar a variável piora o valor
+    sign = (this->mode == MAXIMIZE) ? -1 : 1;
+    gap = fabs(incumbent - solver->getOptimum());
+    reducedCosts = solver->getReducedCosts();
+    values = solver->getSolution();
+
+    for(long long j = 0; j < values.rows(); j++) {
+        if(fabs(reducedCosts(j)) < REDUCED_COST_TOLERANCE) {
+            continue;
+        }
+        //variáveis contínuas não arredondam a distância permitida
+        range = gap / fabs(reducedCosts(j)) + PROPAGATION_INTEGER_TOLERANCE;
+        if(this->ilp->isInteger(j)) {
+            range = floor(range);
+        }
+        change.variable = j;
+        if(sign * reducedCosts(j) > 0 && values(j) <= lower(j) + PROPAGATION_INTEGER_TOLERANCE && lower(j) + range < upper(j)) {
+            upper(j) = lower(j) + range;
+        } else if(sign * reducedCosts(j) < 0 && values(j) >= upper(j) - PROPAGATION_INTEGER_TOLERANCE && upper(j) - range > lower(j)) {
+            lower(j) = upper(j) - range;
         } else {
-            this->foundSolution = true;
-            this->optimum = node->solver->getOptimum();
-            this->solution = node->solver->getSolution();
+            continue;
+        }
+        change.lower = lower(j);
+        change.upper = upper(j);
+        fixings.push_back(change);
+    }
+    this->fixedBounds += fixings.size();
+    return fixings;
+}
+
+/**
+ * @desc Propaga as alterações novas do nó (as que o pai não tinha) pelas restrições do problema
+ * @desc e acrescenta ao nó os limites apertados, que encolhem o seu PL e os dos seus filhos
+ *
+ * @param Node *node nó recém criado
+ * @returns bool false se o nó é inviável
+ */
+bool BranchBound::propagateNode(Node *node) {
+    VectorXd lower, upper, previousLower, previousUpper;
+    vector<long long> changed;
+    BoundChange change;
+    long long tightened = 0;
+
+    this->getNodeBounds(node, lower, upper);
+    previousLower = lower;
+    previousUpper = upper;
+    for(size_t i = node->inherited; i < node->changes.size(); i++) {
+        changed.push_back(node->changes[i].variable);
+    }
+
+    if(!this->propagator->propagate(lower, upper, changed, tightened)) {
+        return false;
+    }
+    this->propagatedBounds += tightened;
+
+    for(long long j = 0; j < lower.rows() && tightened > 0; j++) {
+        if(lower(j) != previousLower(j) || upper(j) != previousUpper(j)) {
+            change.variable = j;
+            change.lower = lower(j);
+            change.upper = upper(j);
+            node->changes.push_back(change);
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Cria um filho com as alterações do pai, as fixações por custo reduzido do pai e a
+ * @desc alteração da variável de ramificação
+ *
+ * @param Node *parent nó pai (já resolvido)
+ * @param const vector<BoundChange> &fixings fixações por custo reduzido feitas no pai
+ * @param long long pos índice da variável de ramificação
+ * @param double lower novo limite inferior
+ * @param double upper novo limite superior
+ * @param bool up true se o filho é o ramo direito (x >= parte inteira + 1)
+ * @param double distance distância entre o valor fracionário e o novo limite
+ * @returns Node*
+ */
+Node* BranchBound::createChild(Node *parent, const vector<BoundChange> &fixings, long long pos, double lower, double upper, bool up, double distance) {
+    Node *child = new Node();
+    BoundChange change;
+
+    change.variable = pos;
+    change.lower = lower;
+    change.upper = upper;
+    child->changes.reserve(parent->changes.size() + fixings.size() + 1);
+    child->changes.assign(parent->changes.begin(), parent->changes.end());
+    child->changes.insert(child->changes.end(), fixings.begin(), fixings.end());
+    child->changes.push_back(change);
+    child->inherited = parent->changes.size();
+    child->cuts = parent->cuts;
+    child->bound = parent->bound;
+    child->estimate = parent->estimate;
+    child->depth = parent->depth + 1;
+    child->id = this->createdNodes++;
+    child->parentId = parent->id;
+    child->branchVariable = pos;
+    child->branchUp = up;
+    child->branchDistance = distance;
+    return child;
+}
+
+/**
+ * @desc Busca os limites atuais de uma variável no nó (a última alteração vale)
+ *
+ * @param Node *node
+ * @param long long variable índice da variável
+ * @param double &lower retorna o limite inferior
+ * @param double &upper retorna o limite superior
+ * @returns void
+ */
+void BranchBound::getBounds(Node *node, long long variable, double &lower, double &upper) {
+    for(long long i = (long long) node->changes.size() - 1; i >= 0; i--) {
+        if(node->changes[i].variable == variable) {
+            lower = node->changes[i].lower;
+            upper = node->changes[i].upper;
+            return;
         }
     }
+    lower = this->ilp->getLowerBounds()(variable);
+    upper = this->ilp->getUpperBounds()(variable);
+}
+
+/**
+ * @desc Executa as heurísticas primais em um nó fracionário: arredondamento em todo nó,
+ * @desc mergulho (fracionário ou guiado pelo incumbente) na raiz e a cada HEURISTIC_FREQUENCY
+ * @desc nós da thread, e feasibility pump apenas na raiz. Cada solução encontrada vai
+ * @desc imediatamente para o incumbente.
+ *
+ * @param Worker *worker thread que explora o nó
+ * @param Node *node nó explorado
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @returns void
+ */
+void BranchBound::runHeuristics(Worker *worker, Node *node, LPSolver *solver) {
+    PrimalHeuristics *heuristics = worker->heuristics;
+    VectorXd lower, upper, incumbent;
+    bool root = (node->parentId == -1);
+
+    if(!this->useHeuristics) {
+        return;
+    }
+    this->getNodeBounds(node, lower, upper);
+
+    if(heuristics->rounding(solver->getSolution(), lower, upper)) {
+        this->updateIncumbent(heuristics->getSolution(), heuristics->getOptimum(), true);
+    }
+
+    if(root && heuristics->feasibilityPump(solver, lower, upper)) {
+        this->updateIncumbent(heuristics->getSolution(), heuristics->getOptimum(), true);
+    }
+
+    if(root || worker->numberOfNodes % HEURISTIC_FREQUENCY == 0) {
+        {
+            lock_guard<mutex> guard(this->incumbentLock);
+            incumbent = this->solution;
+        }
+        if(heuristics->diving(solver, lower, upper, incumbent, this->optimum)) {
+            this->updateIncumbent(heuristics->getSolution(), heuristics->getOptimum(), true);
+        }
+    }
+}
+
+/**
+ * @desc Rodadas de separação na relaxação de um nó (ou da raiz). Em cada rodada os cortes do
+ * @desc pool global violados pelo ponto e os cortes novos dos separadores passam por um pool
+ * @desc da rodada, que descarta os repetidos e escolhe os mais eficazes. Fora da raiz, os cortes
+ * @desc ficam no nó e são herdados pelos filhos; os que valem na árvore toda (não dependem dos
+ * @desc limites do nó) também entram no pool global.
+ *
+ * @param Worker *worker thread que explora o nó (dona dos separadores)
+ * @param Node *node nó explorado
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @param long long rounds número máximo de rodadas
+ * @returns void
+ */
+void BranchBound::separateCuts(Worker *worker, Node *node, LPSolver *solver, long long rounds) {
+    long long size = this->getNodeSize(node);
+    vector<SparseVector<double> > found;
+    vector<Cut*> selected;
+    CutPool *roundPool;
+    VectorXd point;
+    double bound;
+    Separator *separator;
+
+    for(long long r = 0; r < rounds; r++) {
+        point = solver->getSolution();
+        bound = solver->getOptimum();
+        roundPool = new CutPool(this->ilp->getObjectiveFunction().rows());
+
+        {
+            lock_guard<mutex> guard(this->cutLock);
+            selected = this->cutPool->getViolated(point, MAX_CUTS_PER_ROUND);
+            for(size_t i = 0; i < selected.size(); i++) {
+                roundPool->add(selected[i]->constraint, point, -1);
+            }
+        }
+        for(size_t k = 0; k < worker->separators.size(); k++) {
+            found.clear();
+            worker->separators[k]->run(solver, point, found);
+            for(size_t i = 0; i < found.size(); i++) {
+                roundPool->add(found[i], point, k);
+            }
+        }
+
+        //os cortes da rodada entram juntos na relaxação
+        selected = roundPool->select(point, MAX_CUTS_PER_ROUND);
+        found.clear();
+        for(size_t i = 0; i < selected.size(); i++) {
+            found.push_back(selected[i]->constraint);
+        }
+        solver->addConstraints(found, 1);
+        for(size_t i = 0; i < selected.size(); i++) {
+            if(node->depth > 0) {
+                node->cuts.push_back(selected[i]->constraint);
+            }
+            //família -1: o corte veio do pool global
+            if(selected[i]->family < 0) {
+                continue;
+            }
+            separator = worker->separators[selected[i]->family];
+            separator->registerApplied(1);
+            if(node->depth > 0 && !separator->isLocal()) {
+                lock_guard<mutex> guard(this->cutLock);
+                this->cutPool->add(selected[i]->constraint, point, selected[i]->family);
+            }
+        }
+        this->appliedCuts += selected.size();
+        delete roundPool;
+
+        if(selected.empty()) {
+            break;
+        }
+        solver->reoptimize();
+        if(!solver->hasSolution() || fabs(solver->getOptimum() - bound) < CUT_MIN_IMPROVEMENT
+            || this->findBranch(solver->getSolution()) == -1) {
+            break;
+        }
+    }
+
+    //o nó já foi contado em pushNode: soma apenas a memória dos cortes novos
+    this->nodeMemory += this->getNodeSize(node) - size;
+}
+
+/**
+ * @desc Monta os limites de todas as variáveis no nó
+ *
+ * @param Node *node
+ * @param VectorXd &lower retorna os limites inferiores
+ * @param VectorXd &upper retorna os limites superiores
+ * @returns void
+ */
+void BranchBound::getNodeBounds(Node *node, VectorXd &lower, VectorXd &upper) {
+    lower = this->ilp->getLowerBounds();
+    upper = this->ilp->getUpperBounds();
+    for(size_t i = 0; i < node->changes.size(); i++) {
+        lower(node->changes[i].variable) = node->changes[i].lower;
+        upper(node->changes[i].variable) = node->changes[i].upper;
+    }
+}
+
+/**
+ * @desc Atualiza a solução incumbente compartilhada, se a nova for melhor.
+ * @desc O ótimo é atômico, então as outras threads passam a podar imediatamente.
+ *
+ * @param const VectorXd &solution solução inteira (de um nó ou de uma heurística)
+ * @param double optimum valor da solução
+ * @param bool heuristic true se a solução veio de uma heurística primal
+ * @returns void
+ */
+void BranchBound::updateIncumbent(const VectorXd &solution, double optimum, bool heuristic) {
+    lock_guard<mutex> guard(this->incumbentLock);
+
+    if(!this->isBetterSolution(optimum)) {
+        return;
+    }
+    this->foundSolution = true;
+    this->solution = solution;
+    this->optimum = optimum;
+    if(heuristic) {
+        this->heuristicSolutions++;
+    }
+    if(this->sharedIncumbent != NULL) {
+        this->sharedIncumbent->offer(solution, optimum);
+    }
+
+    //fim do mergulho: a partir daqui a política híbrida usa o melhor limite
+    this->diving = false;
 }
 
 /**
- * @desc Busca por um número Real para ramificar
+ * @desc Traz para a busca o incumbente compartilhado, se ele mudou desde a última importação e
+ * @desc é melhor que o atual: os outros métodos do portfólio passam a podar esta árvore também
+ *
+ * @returns void
+ */
+void BranchBound::importIncumbent() {
+    VectorXd solution;
+    double value;
+    long long version;
+
+    if(this->sharedIncumbent == NULL || this->sharedIncumbent->getVersion() == this->sharedVersion) {
+        return;
+    }
+    if(!this->sharedIncumbent->get(solution, value, version)) {
+        return;
+    }
+    this->sharedVersion = version;
+
+    lock_guard<mutex> guard(this->incumbentLock);
+    if(!this->isBetterSolution(value)) {
+        return;
+    }
+    this->foundSolution = true;
+    this->solution = solution;
+    this->optimum = value;
+    this->importedSolutions++;
+    this->diving = false;
+}
+
+/**
+ * @desc Busca por um número Real para ramificar, entre as variáveis inteiras
  * @desc Foi utilizado a tecnica de Variante de Dakin
  *
  * @param VectorXd vectorToSearch vetor ao qual a busca sera realizada
  * @returns __int64 Retorna o indice da coluna ou -1 se não achou.
  */
 long long BranchBound::findBranch(VectorXd vectorToSearch) {
-    double intPart, floatPart = 0;
+    double fraction, floatPart = BRANCH_INTEGER_TOLERANCE;
     int temp = -1;
     for (long long i = 0; i < vectorToSearch.rows(); i++) {
-        if(modf(vectorToSearch(i), &intPart) > floatPart && modf(vectorToSearch(i), &intPart) < 0.99) {
-            floatPart = modf(vectorToSearch(i), &intPart);
+        //parte fracionária acima do piso (também para valores negativos)
+        fraction = vectorToSearch(i) - floor(vectorToSearch(i));
+        if(this->ilp->isInteger(i) && fraction > floatPart && fraction < 1 - BRANCH_INTEGER_TOLERANCE) {
+            floatPart = fraction;
             temp = i;
         }
     }
     return temp;
 }
 
+/**
+ * @desc Escolhe a variável de ramificação segundo a regra configurada. O strong branching avalia
+ * @desc os dois filhos dos candidatos com alguns pivôs do Simplex dual; a regra de confiabilidade
+ * @desc só faz isso para as variáveis com poucas observações de pseudocusto.
+ *
+ * @param Node *node nó a ser ramificado
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @returns long long índice da variável ou -1 se a solução é inteira
+ */
+long long BranchBound::selectBranch(Node *node, LPSolver *solver) {
+    VectorXd values = solver->getSolution();
+    vector<long long> candidates;
+    vector<double> scores;
+    vector<size_t> order;
+    double fraction, downGain, upGain;
+    long long best = -1;
+
+    if(this->branching == MOST_FRACTIONAL) {
+        return this->findBranch(values);
+    }
+
+    //mesmo critério de fracionariedade de findBranch
+    for(long long i = 0; i < values.rows(); i++) {
+        fraction = values(i) - floor(values(i));
+        if(this->ilp->isInteger(i) && fraction > BRANCH_INTEGER_TOLERANCE && fraction < 1 - BRANCH_INTEGER_TOLERANCE) {
+            candidates.push_back(i);
+            scores.push_back(this->getScore(this->getPseudocost(i, false) * fraction,
+                this->getPseudocost(i, true) * (1 - fraction)));
+        }
+    }
+    if(candidates.empty()) {
+        return -1;
+    }
+
+    if(this->branching != PSEUDOCOST) {
+        //os candidatos mais promissores pelos pseudocustos são avaliados primeiro
+        for(size_t k = 0; k < candidates.size(); k++) {
+            if(this->branching == STRONG_BRANCHING || !this->isReliable(candidates[k])) {
+                order.push_back(k);
+            }
+        }
+        sort(order.begin(), order.end(), [&scores](size_t first, size_t second) { return scores[first] > scores[second]; });
+        if(order.size() > STRONG_CANDIDATES) {
+            order.resize(STRONG_CANDIDATES);
+        }
+
+        for(size_t k = 0; k < order.size(); k++) {
+            this->strongBranch(node, solver, candidates[order[k]], downGain, upGain);
+            scores[order[k]] = this->getScore(downGain, upGain);
+        }
+    }
+
+    for(size_t k = 0; k < candidates.size(); k++) {
+        if(best == -1 || scores[k] > scores[best]) {
+            best = k;
+        }
+    }
+    return candidates[best];
+}
+
+/**
+ * @desc Avalia os dois filhos de uma variável com um número limitado de pivôs do Simplex dual.
+ * @desc O ganho é a degradação do valor da relaxação; um filho inviável recebe ganho infinito.
+ * @desc Os ganhos dos filhos viáveis também atualizam os pseudocustos.
+ *
+ * @param Node *node nó a ser ramificado
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @param long long variable índice da variável candidata
+ * @param double &downGain retorna o ganho do ramo esquerdo
+ * @param double &upGain retorna o ganho do ramo direito
+ * @returns void
+ */
+void BranchBound::strongBranch(Node *node, LPSolver *solver, long long variable, double &downGain, double &upGain) {
+    double value = solver->getSolution()(variable);
+    double intPart = floor(value);
+    double lower, upper;
+    LPSolver *child;
+
+    this->getBounds(node, variable, lower, upper);
+
+    child = solver->clone();
+    child->setBounds(variable, lower, intPart);
+    if(child->dualReoptimize(STRONG_PIVOT_LIMIT)) {
+        downGain = fabs(solver->getOptimum() - child->getObjectiveValue());
+        this->updatePseudocost(variable, false, value - intPart, downGain);
+    } else {
+        downGain = numeric_limits<double>::infinity();
+    }
+    delete child;
+
+    child = solver->clone();
+    child->setBounds(variable, intPart + 1, upper);
+    if(child->dualReoptimize(STRONG_PIVOT_LIMIT)) {
+        upGain = fabs(solver->getOptimum() - child->getObjectiveValue());
+        this->updatePseudocost(variable, true, intPart + 1 - value, upGain);
+    } else {
+        upGain = numeric_limits<double>::infinity();
+    }
+    delete child;
+}
+
+/**
+ * @desc Registra uma observação de pseudocusto: ganho por unidade de distância
+ *
+ * @param long long variable índice da variável
+ * @param bool up true para o ramo direito
+ * @param double distance distância entre o valor fracionário e o novo limite
+ * @param double gain degradação do valor da relaxação
+ * @returns void
+ */
+void BranchBound::updatePseudocost(long long variable, bool up, double distance, double gain) {
+    lock_guard<mutex> guard(this->pseudocostLock);
+
+    if(distance <= 0) {
+        return;
+    }
+    this->pseudocostSum[up](variable) += gain / distance;
+    this->pseudocostCount[up][variable]++;
+}
+
+/**
+ * @desc Retorna o pseudocusto médio da variável. Sem observações, usa a média das variáveis
+ * @desc já observadas no mesmo sentido, ou 1 se nenhuma foi observada.
+ *
+ * @param long long variable índice da variável
+ * @param bool up true para o ramo direito
+ * @returns double
+ */
+double BranchBound::getPseudocost(long long variable, bool up) {
+    lock_guard<mutex> guard(this->pseudocostLock);
+    double sum = 0;
+    long long count = 0;
+
+    if(this->pseudocostCount[up][variable] > 0) {
+        return this->pseudocostSum[up](variable) / this->pseudocostCount[up][variable];
+    }
+    for(long long i = 0; i < this->pseudocostSum[up].rows(); i++) {
+        if(this->pseudocostCount[up][i] > 0) {
+            sum += this->pseudocostSum[up](i) / this->pseudocostCount[up][i];
+            count++;
+        }
+    }
+    return (count > 0) ? sum / count : 1;
+}
+
+/**
+ * @desc Verifica se a variável tem observações de pseudocusto suficientes nos dois sentidos
+ *
+ * @param long long variable índice da variável
+ * @returns bool
+ */
+bool BranchBound::isReliable(long long variable) {
+    lock_guard<mutex> guard(this->pseudocostLock);
+
+    return this->pseudocostCount[0][variable] >= RELIABILITY_THRESHOLD
+        && this->pseudocostCount[1][variable] >= RELIABILITY_THRESHOLD;
+}
+
+/**
+ * @desc Pontuação de um candidato pela regra do produto dos ganhos dos dois filhos
+ *
+ * @param double downGain ganho do ramo esquerdo
+ * @param double upGain ganho do ramo direito
+ * @returns double
+ */
+double BranchBound::getScore(double downGain, double upGain) {
+    return fmax(downGain, SCORE_EPSILON) * fmax(upGain, SCORE_EPSILON);
+}
+
+/**
+ * @desc Estimativa do melhor valor inteiro na subárvore do nó: o valor da relaxação
+ * @desc piorado, para cada variável inteira fracionária, pelo custo de arredondá-la
+ *
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @returns double
+ */
+double BranchBound::getEstimate(LPSolver *solver) {
+    VectorXd objectiveFunction = this->ilp->getObjectiveFunction();
+    VectorXd values = solver->getSolution();
+    double degradation = 0, fraction;
+
+    for(long long i = 0; i < values.rows(); i++) {
+        if(!this->ilp->isInteger(i)) {
+            continue;
+        }
+        fraction = values(i) - floor(values(i));
+        degradation += fabs(objectiveFunction(i)) * fmin(fraction, 1 - fraction);
+    }
+
+    return (this->mode == MAXIMIZE) ? solver->getOptimum() - degradation : solver->getOptimum() + degradation;
+}
+
+/**
+ * @desc Insere um nó na fila de nós abertos de uma thread e o seu limite no conjunto de limites
+ * @desc pendentes, e atualiza a memória ocupada pelos nós abertos (o pico é atualizado sem bloqueio)
+ *
+ * @param Worker *worker
+ * @param Node *node
+ * @returns void
+ */
+void BranchBound::pushNode(Worker *worker, Node *node) {
+    long long size, peak;
+
+    {
+        lock_guard<mutex> guard(this->boundLock);
+        node->boundEntry = this->nodeBounds.insert(node->bound);
+    }
+
+    size = (this->nodeMemory += this->getNodeSize(node));
+    peak = this->peakNodeMemory;
+    while(size > peak && !this->peakNodeMemory.compare_exchange_weak(peak, size));
+
+    lock_guard<mutex> guard(worker->lock);
+
+    this->pendingNodes++;
+    worker->openNodes.push_back(node);
+    push_heap(worker->openNodes.begin(), worker->openNodes.end(),
+        [this, worker](Node *first, Node *second) { return this->isWorseNode(first, second, worker->diving); });
+}
+
+/**
+ * @desc Retira da fila de uma thread o nó aberto de maior prioridade
+ *
+ * @param Worker *worker
+ * @returns Node* ou NULL se a fila estiver vazia
+ */
+Node* BranchBound::popNode(Worker *worker) {
+    lock_guard<mutex> guard(worker->lock);
+
+    if(worker->openNodes.empty()) {
+        return NULL;
+    }
+
+    //a política híbrida saiu do mergulho: reordena a fila pelo melhor limite
+    if(worker->diving != this->diving) {
+        worker->diving = this->diving;
+        make_heap(worker->openNodes.begin(), worker->openNodes.end(),
+            [this, worker](Node *first, Node *second) { return this->isWorseNode(first, second, worker->diving); });
+    }
+
+    pop_heap(worker->openNodes.begin(), worker->openNodes.end(),
+        [this, worker](Node *first, Node *second) { return this->isWorseNode(first, second, worker->diving); });
+    Node *node = worker->openNodes.back();
+    worker->openNodes.pop_back();
+    return node;
+}
+
+/**
+ * @desc Rouba o nó de maior prioridade da fila de outra thread
+ *
+ * @param int thiefId índice da thread sem trabalho
+ * @returns Node* ou NULL se todas as filas estiverem vazias
+ */
+Node* BranchBound::stealNode(int thiefId) {
+    Node *node;
+
+    for(int i = 1; i < this->numberOfThreads; i++) {
+        node = this->popNode(this->workers[(thiefId + i) % this->numberOfThreads]);
+        if(node != NULL) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @desc Libera um nó explorado ou podado. O seu limite só sai do conjunto de limites pendentes
+ * @desc depois que os filhos entraram, então o limite dual global nunca deixa de cobrir a subárvore.
+ *
+ * @param Node *node
+ * @returns void
+ */
+void BranchBound::releaseNode(Node *node) {
+    {
+        lock_guard<mutex> guard(this->boundLock);
+        this->nodeBounds.erase(node->boundEntry);
+    }
+    this->nodeMemory -= this->getNodeSize(node);
+    delete node;
+}
+
+/**
+ * @desc Devolve à fila um nó cuja exploração foi interrompida por um limite. O nó ainda está
+ * @desc contado nos nós pendentes, na memória e nos limites pendentes.
+ *
+ * @param Worker *worker
+ * @param Node *node
+ * @returns void
+ */
+void BranchBound::requeueNode(Worker *worker, Node *node) {
+    lock_guard<mutex> guard(worker->lock);
+
+    worker->openNodes.push_back(node);
+    push_heap(worker->openNodes.begin(), worker->openNodes.end(),
+        [this, worker](Node *first, Node *second) { return this->isWorseNode(first, second, worker->diving); });
+}
+
+/**
+ * @desc Verifica se algum limite do orçamento foi atingido (ou a busca foi cancelada)
+ *
+ * @returns bool
+ */
+bool BranchBound::isLimitReached() {
+    return this->limits != NULL && this->limits->isReached();
+}
+
+/**
+ * @desc Memória ocupada por um nó aberto (estrutura e lista de alterações)
+ *
+ * @param Node *node
+ * @returns long long bytes
+ */
+long long BranchBound::getNodeSize(Node *node) {
+    long long size = sizeof(Node) + node->changes.capacity() * sizeof(BoundChange);
+
+    for(size_t i = 0; i < node->cuts.size(); i++) {
+        size += sizeof(SparseVector<double>) + node->cuts[i].nonZeros() * (sizeof(double) + sizeof(SparseVector<double>::StorageIndex));
+    }
+    return size + (node->cuts.capacity() - node->cuts.size()) * sizeof(SparseVector<double>);
+}
+
+/**
+ * @desc Compara a prioridade de dois nós abertos segundo a política de seleção
+ *
+ * @param Node *first
+ * @param Node *second
+ * @param bool diving true se a política híbrida ainda está mergulhando
+ * @returns bool true se first deve ser explorado depois de second
+ */
+bool BranchBound::isWorseNode(Node *first, Node *second, bool diving) {
+    int policy = this->nodeSelection;
+    double firstValue, secondValue;
+
+    if(policy == HYBRID) {
+        policy = diving ? DEPTH_FIRST : BEST_BOUND;
+    }
+
+    if(policy != DEPTH_FIRST) {
+        firstValue = (policy == BEST_ESTIMATE) ? first->estimate : first->bound;
+        secondValue = (policy == BEST_ESTIMATE) ? second->estimate : second->bound;
+        if(firstValue != secondValue) {
+            return (this->mode == MAXIMIZE) ? firstValue < secondValue : firstValue > secondValue;
+        }
+    }
+
+    //mais profundo primeiro e, no mesmo nível, o criado antes (ramo esquerdo)
+    if(first->depth != second->depth) {
+        return first->depth < second->depth;
+    }
+    return first->id > second->id;
+}
+
 /**
  * @desc Verifica se a solução atual é melhor
  *
@@ -120,6 +1104,40 @@ bool BranchBound::isBetterSolution(double optimumFound) {
     return false;
 }
 
+/**
+ * @desc Limite de um nó para a poda: com custos inteiros nenhuma solução da subárvore é melhor
+ * @desc que o limite arredondado para o inteiro seguinte (no sentido da otimização)
+ *
+ * @param double bound valor da relaxação
+ * @returns double
+ */
+double BranchBound::roundBound(double bound) {
+    if(!this->integralObjective || isinf(bound)) {
+        return bound;
+    }
+    if(this->mode == MAXIMIZE) {
+        return floor(bound + OBJECTIVE_INTEGER_TOLERANCE);
+    }
+    return ceil(bound - OBJECTIVE_INTEGER_TOLERANCE);
+}
+
+/**
+ * @desc Verifica se o incumbente está a menos do gap absoluto ou relativo do limite dual global
+ *
+ * @returns bool
+ */
+bool BranchBound::isGapClosed() {
+    {
+        lock_guard<mutex> guard(this->incumbentLock);
+        if(!this->foundSolution) {
+            return false;
+        }
+    }
+    double gap = fabs(this->optimum - this->getDualBound());
+
+    return gap <= this->absoluteGap || gap <= this->relativeGap * (GAP_EPSILON + fabs(this->optimum));
+}
+
 /**
  * @desc Retorna true se a solução foi encontrada.
  * @desc Retorna false caso contrário.
@@ -131,6 +1149,16 @@ bool BranchBound::hasSolution() {
 }
 
 
+/**
+ * @desc Retorna a situação do resultado: OPTIMAL, INFEASIBLE, UNBOUNDED ou LIMIT_REACHED
+ * @desc (com o melhor incumbente encontrado e o limite dual dos nós que ficaram abertos)
+ *
+ * @returns int
+ */
+int BranchBound::getStatus() {
+    return this->status;
+}
+
 /**
  * @desc Retorna o valor ótimo da funcao objetivo maximizado ou minimizado com valores inteiros
  *
@@ -148,3 +1176,163 @@ double BranchBound::getOptimum() {
 VectorXd BranchBound::getSolution() {
     return this->solution;
 }
+
+/**
+ * @desc Retorna o limite dual global: o melhor valor entre a solução encontrada e as
+ * @desc relaxações dos nós abertos ou em exploração (igual ao ótimo quando a árvore se esgota).
+ * @desc Pode ser consultado durante a busca.
+ *
+ * @returns double
+ */
+double BranchBound::getDualBound() {
+    lock_guard<mutex> guard(this->boundLock);
+    double bound = this->optimum;
+
+    if(this->nodeBounds.empty()) {
+        //sem nós pendentes e sem incumbente (PL da raiz interrompido): nada se sabe sobre o ótimo
+        if(bound == numeric_limits<double>::lowest() || bound == numeric_limits<double>::max()) {
+            return (this->mode == MAXIMIZE) ? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity();
+        }
+        return bound;
+    }
+    if(this->mode == MAXIMIZE) {
+        return fmax(bound, this->roundBound(*this->nodeBounds.rbegin()));
+    }
+    return fmin(bound, this->roundBound(*this->nodeBounds.begin()));
+}
+
+/**
+ * @desc Retorna o gap relativo entre o incumbente e o limite dual global
+ * @desc (infinito se nenhuma solução foi encontrada)
+ *
+ * @returns double
+ */
+double BranchBound::getGap() {
+    {
+        lock_guard<mutex> guard(this->incumbentLock);
+        if(!this->foundSolution) {
+            return numeric_limits<double>::infinity();
+        }
+    }
+    return fabs(this->optimum - this->getDualBound()) / (GAP_EPSILON + fabs(this->optimum));
+}
+
+/**
+ * @desc Retorna o número de nós explorados (soma de todas as threads)
+ *
+ * @returns long long
+ */
+long long BranchBound::getNumberOfNodes() {
+    long long total = 0;
+
+    for(size_t k = 0; k < this->workers.size(); k++) {
+        total += this->workers[k]->numberOfNodes;
+    }
+    return total;
+}
+
+/**
+ * @desc Retorna o número de nós explorados por cada thread
+ *
+ * @returns vector<long long>
+ */
+vector<long long> BranchBound::getNodesPerThread() {
+    vector<long long> nodes;
+
+    for(size_t k = 0; k < this->workers.size(); k++) {
+        nodes.push_back(this->workers[k]->numberOfNodes);
+    }
+    return nodes;
+}
+
+/**
+ * @desc Retorna quantas vezes o incumbente foi melhorado pelas heurísticas primais
+ *
+ * @returns long long
+ */
+long long BranchBound::getHeuristicSolutions() {
+    return this->heuristicSolutions;
+}
+
+/**
+ * @desc Retorna o número de incumbentes importados de outros métodos do portfólio
+ *
+ * @returns long long
+ */
+long long BranchBound::getImportedSolutions() {
+    return this->importedSolutions;
+}
+
+/**
+ * @desc Retorna o pico de memória ocupada pelos nós abertos
+ *
+ * @returns long long bytes
+ */
+long long BranchBound::getPeakNodeMemory() {
+    return this->peakNodeMemory;
+}
+
+/**
+ * @desc Retorna o valor da relaxação da raiz antes dos cortes
+ *
+ * @returns double
+ */
+double BranchBound::getRootBound() {
+    return this->rootBound;
+}
+
+/**
+ * @desc Retorna o valor da relaxação da raiz depois das rodadas de separação
+ *
+ * @returns double
+ */
+double BranchBound::getCutBound() {
+    return this->cutBound;
+}
+
+/**
+ * @desc Retorna o número de cortes inseridos nas relaxações (raiz e nós)
+ *
+ * @returns long long
+ */
+long long BranchBound::getAppliedCuts() {
+    return this->appliedCuts;
+}
+
+/**
+ * @desc Retorna o número de cortes globais no pool compartilhado pela árvore
+ *
+ * @returns long long
+ */
+long long BranchBound::getPoolSize() {
+    lock_guard<mutex> guard(this->cutLock);
+
+    return this->cutPool->size();
+}
+
+/**
+ * @desc Retorna o número de limites apertados pela propagação de domínios nos nós
+ *
+ * @returns long long
+ */
+long long BranchBound::getPropagatedBounds() {
+    return this->propagatedBounds;
+}
+
+/**
+ * @desc Retorna o número de limites apertados pela fixação por custo reduzido
+ *
+ * @returns long long
+ */
+long long BranchBound::getFixedBounds() {
+    return this->fixedBounds;
+}
+
+/**
+ * @desc Retorna o número de nós podados pela propagação, antes de resolver o seu PL
+ *
+ * @returns long long
+ */
+long long BranchBound::getPrunedNodes() {
+    return this->prunedNodes;
+}
@@ -0,0 +1,131 @@
+#include "../headers/CliqueSeparator.h"
+#include <Eigen>
+#include <cmath>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: monta o grafo de conflitos com os pares de itens de cada mochila cuja soma
+ * @desc dos pesos passa da capacidade
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ */
+CliqueSeparator::CliqueSeparator(Problem *ilp) : Separator(ilp, "Clique") {
+    vector<long long> variables, order, literals;
+    vector<double> weights;
+    vector<bool> complemented;
+    double capacity;
+    long long first, second;
+
+    this->conflicts.assign(2 * this->numberOfVariables, vector<long long>());
+
+    for(size_t r = 0; r < this->rows.size(); r++) {
+        if(!this->getKnapsack(r, variables, weights, complemented, capacity)) {
+            continue;
+        }
+        literals.clear();
+        order.clear();
+        for(size_t k = 0; k < variables.size(); k++) {
+            literals.push_back(complemented[k] ? variables[k] + this->numberOfVariables : variables[k]);
+            order.push_back(k);
+        }
+
+        //com os itens do mais pesado para o mais leve, o laço interno para no primeiro par sem conflito
+        sort(order.begin(), order.end(), [&weights](long long a, long long b) { return weights[a] > weights[b]; });
+        if(order.size() > CLIQUE_ROW_LIMIT) {
+            order.resize(CLIQUE_ROW_LIMIT);
+        }
+        for(size_t a = 0; a < order.size(); a++) {
+            for(size_t b = a + 1; b < order.size(); b++) {
+                if(weights[order[a]] + weights[order[b]] <= capacity + SEPARATION_TOLERANCE) {
+                    break;
+                }
+                first = literals[order[a]];
+                second = literals[order[b]];
+                this->conflicts[first].push_back(second);
+                this->conflicts[second].push_back(first);
+            }
+        }
+    }
+
+    for(size_t k = 0; k < this->conflicts.size(); k++) {
+        sort(this->conflicts[k].begin(), this->conflicts[k].end());
+        this->conflicts[k].erase(unique(this->conflicts[k].begin(), this->conflicts[k].end()), this->conflicts[k].end());
+    }
+}
+
+/**
+ * @desc Monta gulosamente uma clique a partir de cada um dos CLIQUE_SEEDS literais de maior valor
+ * @desc no ponto, acrescentando os literais (do maior valor para o menor) ligados a todos os da
+ * @desc clique; gera o corte quando a soma dos valores passa de 1.
+ *
+ * @param LPSolver *solver relaxação resolvida (não usada)
+ * @param const VectorXd &point solução da relaxação
+ * @param vector<SparseVector<double> > &cuts recebe os cortes
+ * @returns void
+ */
+void CliqueSeparator::separate(LPSolver *, const VectorXd &point, vector<SparseVector<double> > &cuts) {
+    long long n = this->numberOfVariables;
+    vector<long long> candidates, clique;
+    vector<double> values(2 * n, 0);
+    VectorXd cut;
+    double activity, cutRhs;
+    bool adjacent;
+
+    for(long long k = 0; k < 2 * n; k++) {
+        if(this->conflicts[k].empty()) {
+            continue;
+        }
+        values[k] = (k < n) ? point(k) : 1 - point(k - n);
+        if(values[k] > SEPARATION_TOLERANCE) {
+            candidates.push_back(k);
+        }
+    }
+    sort(candidates.begin(), candidates.end(), [&values](long long a, long long b) { return values[a] > values[b]; });
+
+    for(size_t seed = 0; seed < candidates.size() && seed < CLIQUE_SEEDS; seed++) {
+        clique.assign(1, candidates[seed]);
+        activity = values[candidates[seed]];
+        for(size_t k = 0; k < candidates.size(); k++) {
+            if(k == seed) {
+                continue;
+            }
+            adjacent = true;
+            for(size_t c = 0; c < clique.size() && adjacent; c++) {
+                adjacent = this->isConflict(candidates[k], clique[c]);
+            }
+            if(adjacent) {
+                clique.push_back(candidates[k]);
+                activity += values[candidates[k]];
+            }
+        }
+        if(activity <= 1 + SEPARATION_TOLERANCE) {
+            continue;
+        }
+
+        //literal x: +x; literal 1 - x: -x e o lado direito diminui 1
+        cut = VectorXd::Zero(n);
+        cutRhs = 1;
+        for(size_t c = 0; c < clique.size(); c++) {
+            if(clique[c] < n) {
+                cut(clique[c]) += 1;
+            } else {
+                cut(clique[c] - n) -= 1;
+                cutRhs -= 1;
+            }
+        }
+        cuts.push_back(this->makeCut(cut, cutRhs));
+    }
+}
+
+/**
+ * @desc Verifica se dois literais estão ligados no grafo de conflitos
+ *
+ * @param long long first
+ * @param long long second
+ * @returns bool
+ */
+bool CliqueSeparator::isConflict(long long first, long long second) {
+    return binary_search(this->conflicts[first].begin(), this->conflicts[first].end(), second);
+}
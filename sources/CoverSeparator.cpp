@@ -0,0 +1,99 @@
+#include "../headers/CoverSeparator.h"
+#include <Eigen>
+#include <cmath>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ */
+CoverSeparator::CoverSeparator(Problem *ilp) : Separator(ilp, "Cobertura") {
+}
+
+/**
+ * @desc Para cada mochila sum(w.y) <= c: monta gulosamente uma cobertura C (sum(w) > c) com os
+ * @desc itens de maior valor no ponto, a torna minimal e, se sum(y, C) <= |C| - 1 é violado,
+ * @desc estende a cobertura com os itens de peso maior ou igual ao maior peso de C.
+ *
+ * @param LPSolver *solver relaxação resolvida (não usada)
+ * @param const VectorXd &point solução da relaxação
+ * @param vector<SparseVector<double> > &cuts recebe os cortes
+ * @returns void
+ */
+void CoverSeparator::separate(LPSolver *, const VectorXd &point, vector<SparseVector<double> > &cuts) {
+    vector<long long> variables, order, cover;
+    vector<double> weights, values;
+    vector<bool> complemented, inCover;
+    VectorXd cut;
+    double capacity, weight, maxWeight, activity, cutRhs;
+
+    for(size_t r = 0; r < this->rows.size(); r++) {
+        if(!this->getKnapsack(r, variables, weights, complemented, capacity)) {
+            continue;
+        }
+
+        values.assign(variables.size(), 0);
+        order.clear();
+        for(size_t k = 0; k < variables.size(); k++) {
+            values[k] = complemented[k] ? 1 - point(variables[k]) : point(variables[k]);
+            order.push_back(k);
+        }
+
+        //itens mais próximos de 1 primeiro (e, no empate, os mais pesados)
+        sort(order.begin(), order.end(), [&values, &weights](long long first, long long second) {
+            if(values[first] != values[second]) {
+                return values[first] > values[second];
+            }
+            return weights[first] > weights[second];
+        });
+        cover.clear();
+        weight = 0;
+        for(size_t k = 0; k < order.size() && weight <= capacity; k++) {
+            cover.push_back(order[k]);
+            weight += weights[order[k]];
+        }
+        if(weight <= capacity) {
+            continue;
+        }
+
+        //cobertura minimal: retira os itens de menor valor enquanto continua sendo cobertura
+        for(long long k = (long long) cover.size() - 1; k >= 0; k--) {
+            if(weight - weights[cover[k]] > capacity) {
+                weight -= weights[cover[k]];
+                cover.erase(cover.begin() + k);
+            }
+        }
+
+        activity = 0;
+        maxWeight = 0;
+        inCover.assign(variables.size(), false);
+        for(size_t k = 0; k < cover.size(); k++) {
+            activity += values[cover[k]];
+            maxWeight = fmax(maxWeight, weights[cover[k]]);
+            inCover[cover[k]] = true;
+        }
+        if(activity <= cover.size() - 1 + SEPARATION_TOLERANCE) {
+            continue;
+        }
+
+        //cobertura estendida: itens fora de C com peso >= maior peso de C
+        cut = VectorXd::Zero(this->numberOfVariables);
+        cutRhs = cover.size() - 1;
+        for(size_t k = 0; k < variables.size(); k++) {
+            if(!inCover[k] && weights[k] < maxWeight) {
+                continue;
+            }
+            //y = x ou y = 1 - x
+            if(complemented[k]) {
+                cut(variables[k]) -= 1;
+                cutRhs -= 1;
+            } else {
+                cut(variables[k]) += 1;
+            }
+        }
+        cuts.push_back(this->makeCut(cut, cutRhs));
+    }
+}
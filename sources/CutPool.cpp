@@ -0,0 +1,209 @@
+#include "../headers/CutPool.h"
+#include <Eigen>
+#include <cmath>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor
+ *
+ * @param long long numberOfVariables número de variáveis do problema
+ */
+CutPool::CutPool(long long numberOfVariables) {
+    this->numberOfVariables = numberOfVariables;
+    this->nextId = 0;
+}
+
+/**
+ * @desc Destrutor: libera os cortes do pool
+ */
+CutPool::~CutPool() {
+    for(size_t i = 0; i < this->cuts.size(); i++) {
+        delete this->cuts[i];
+    }
+}
+
+/**
+ * @desc Insere um corte violado no pool. Um corte quase paralelo a outro do pool só é mantido se
+ * @desc for mais violado no ponto: substitui o antigo se ele estiver fora do PL, senão entra como
+ * @desc um corte novo.
+ *
+ * @param const SparseVector<double> &constraint coeficientes do corte a.x >= b (último é o lado direito)
+ * @param const VectorXd &point solução atual da relaxação
+ * @param int family índice do separador que gerou o corte
+ * @returns bool true se o corte entrou no pool
+ */
+bool CutPool::add(const SparseVector<double> &constraint, const VectorXd &point, int family) {
+    Cut *cut = new Cut();
+    double efficacy;
+
+    cut->constraint = constraint;
+    cut->rhs = constraint.coeff(this->numberOfVariables);
+    cut->norm = sqrt(fmax(constraint.squaredNorm() - cut->rhs * cut->rhs, 0));
+    cut->age = 0;
+    cut->family = family;
+    cut->active = false;
+
+    if(cut->norm < CUT_SLACK_TOLERANCE || (efficacy = this->getEfficacy(cut, point)) < CUT_MIN_EFFICACY) {
+        delete cut;
+        return false;
+    }
+
+    for(size_t i = 0; i < this->cuts.size(); i++) {
+        if(this->getCosine(cut, this->cuts[i]) < CUT_DUPLICATE_LIMIT) {
+            continue;
+        }
+        if(efficacy <= this->getEfficacy(this->cuts[i], point) + CUT_MIN_EFFICACY) {
+            delete cut;
+            return false;
+        }
+        if(!this->cuts[i]->active) {
+            cut->id = this->cuts[i]->id;
+            delete this->cuts[i];
+            this->cuts[i] = cut;
+            return true;
+        }
+    }
+
+    cut->id = this->nextId++;
+    this->cuts.push_back(cut);
+    return true;
+}
+
+/**
+ * @desc Escolhe até limit cortes fora do PL e os marca como inseridos no PL (ver rank)
+ *
+ * @param const VectorXd &point solução atual da relaxação
+ * @param long long limit número máximo de cortes
+ * @returns vector<Cut*> cortes a serem inseridos no PL
+ */
+vector<Cut*> CutPool::select(const VectorXd &point, long long limit) {
+    vector<Cut*> selected = this->rank(point, limit);
+
+    for(size_t i = 0; i < selected.size(); i++) {
+        selected[i]->active = true;
+        selected[i]->age = 0;
+    }
+    return selected;
+}
+
+/**
+ * @desc Escolhe até limit cortes violados sem marcá-los, para um pool compartilhado por várias
+ * @desc relaxações (os nós do branch-and-cut), em que cada PL tem os seus próprios cortes
+ *
+ * @param const VectorXd &point solução da relaxação
+ * @param long long limit número máximo de cortes
+ * @returns vector<Cut*>
+ */
+vector<Cut*> CutPool::getViolated(const VectorXd &point, long long limit) {
+    return this->rank(point, limit);
+}
+
+/**
+ * @desc Ordena os cortes fora do PL do mais eficaz para o menos eficaz e escolhe até limit,
+ * @desc descartando os quase paralelos a um corte já escolhido
+ *
+ * @param const VectorXd &point solução atual da relaxação
+ * @param long long limit número máximo de cortes
+ * @returns vector<Cut*>
+ */
+vector<Cut*> CutPool::rank(const VectorXd &point, long long limit) {
+    vector<pair<double, Cut*> > candidates;
+    vector<Cut*> selected;
+    double efficacy;
+    bool parallel;
+
+    for(size_t i = 0; i < this->cuts.size(); i++) {
+        if(this->cuts[i]->active) {
+            continue;
+        }
+        efficacy = this->getEfficacy(this->cuts[i], point);
+        if(efficacy >= CUT_MIN_EFFICACY) {
+            candidates.push_back(make_pair(efficacy, this->cuts[i]));
+        }
+    }
+    sort(candidates.begin(), candidates.end(),
+        [](const pair<double, Cut*> &first, const pair<double, Cut*> &second) { return first.first > second.first; });
+
+    for(size_t i = 0; i < candidates.size() && (long long) selected.size() < limit; i++) {
+        parallel = false;
+        for(size_t k = 0; k < selected.size() && !parallel; k++) {
+            parallel = this->getCosine(candidates[i].second, selected[k]) > CUT_PARALLELISM_LIMIT;
+        }
+        if(!parallel) {
+            selected.push_back(candidates[i].second);
+        }
+    }
+    return selected;
+}
+
+/**
+ * @desc Envelhece os cortes depois de uma reotimização: cortes do PL com folga por mais de
+ * @desc CUT_AGE_LIMIT rodadas saem do PL; cortes fora do PL que continuam satisfeitos por mais
+ * @desc de CUT_POOL_AGE_LIMIT rodadas são descartados do pool.
+ *
+ * @param const VectorXd &point nova solução da relaxação
+ * @returns vector<Cut*> cortes que devem ser removidos do PL
+ */
+vector<Cut*> CutPool::age(const VectorXd &point) {
+    vector<Cut*> removed, kept;
+    Cut *cut;
+
+    for(size_t i = 0; i < this->cuts.size(); i++) {
+        cut = this->cuts[i];
+        if(cut->active) {
+            cut->age = (-this->getEfficacy(cut, point) > CUT_SLACK_TOLERANCE) ? cut->age + 1 : 0;
+            if(cut->age > CUT_AGE_LIMIT) {
+                cut->active = false;
+                cut->age = 0;
+                removed.push_back(cut);
+            }
+        } else if(this->getEfficacy(cut, point) < CUT_MIN_EFFICACY && ++cut->age > CUT_POOL_AGE_LIMIT) {
+            delete cut;
+            continue;
+        }
+        kept.push_back(cut);
+    }
+    this->cuts = kept;
+    return removed;
+}
+
+/**
+ * @desc Retorna o número de cortes no pool (dentro e fora do PL)
+ *
+ * @returns long long
+ */
+long long CutPool::size() {
+    return this->cuts.size();
+}
+
+/**
+ * @desc Eficácia do corte no ponto: violação dividida pela norma (negativa se o corte tem folga)
+ *
+ * @param Cut *cut
+ * @param const VectorXd &point
+ * @returns double
+ */
+double CutPool::getEfficacy(Cut *cut, const VectorXd &point) {
+    double activity = 0;
+
+    for(SparseVector<double>::InnerIterator it(cut->constraint); it; ++it) {
+        if(it.index() < this->numberOfVariables) {
+            activity += it.value() * point(it.index());
+        }
+    }
+    return (cut->rhs - activity) / cut->norm;
+}
+
+/**
+ * @desc Cosseno do ângulo entre os coeficientes de dois cortes (sem o lado direito)
+ *
+ * @param Cut *first
+ * @param Cut *second
+ * @returns double
+ */
+double CutPool::getCosine(Cut *first, Cut *second) {
+    //o lado direito está na mesma posição nos dois cortes, então é retirado do produto interno
+    return (first->constraint.dot(second->constraint) - first->rhs * second->rhs) / (first->norm * second->norm);
+}
@@ -1,132 +1,157 @@
 #include "../headers/CuttingPlane.h"
 #include <Eigen>
 #include <cmath>
+#include <algorithm>
+#include <limits>
 
 using namespace Eigen;
 
 /**
- * @desc Construtor
+ * @desc Construtor: rodadas de separação até a relaxação ficar inteira, não haver mais cortes
+ * @desc violados ou algum limite do orçamento ser atingido (o último valor da relaxação fica
+ * @desc como limite dual)
  *
  * @param Problem *ilp problema de Programação Linear Inteira a ser resolvido pelo planos de corte.
  * @param int mode Pode ser: MINIMIZE, MAXIMIZE
+ * @param Limits *limits orçamento de tempo e pivôs, com a ficha de cancelamento (NULL sem limites)
  */
-CuttingPlane::CuttingPlane(Problem *ilp, int mode) {
+CuttingPlane::CuttingPlane(Problem *ilp, int mode, Limits *limits) {
+    vector<Cut*> removed;
+    double bound;
+
+    this->ilp = ilp;
     this->mode = mode;
     this->foundSolution = false;
     this->numberOfVariables = ilp->getObjectiveFunction().rows();
+    this->rounds = 0;
+    this->appliedCuts = 0;
+    this->limits = limits;
+    this->status = INFEASIBLE;
+    this->dualBound = (mode == MAXIMIZE) ? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity();
 
-    this->solver = new Simplex(this->mode, ilp->getObjectiveFunction(), ilp->getConstraints(), ilp->getRelations());
+    this->solver = new Simplex(this->mode, ilp, limits);
+    this->pool = new CutPool(this->numberOfVariables);
+    this->separators = Separator::create(ilp);
 
     while(true) {
         if(!this->solver->hasSolution()) {
+            if(this->solver->getStatus() == LP_INTERRUPTED) {
+                this->status = LIMIT_REACHED;
+            } else if(this->solver->getStatus() == LP_UNBOUNDED) {
+                this->status = UNBOUNDED;
+            } else if(this->rounds > 0) {
+                //inviável só depois dos cortes: pode ser erro numérico dos cortes, não uma prova
+                this->status = STALLED;
+            }
             break;
         }
+        this->dualBound = this->solver->getOptimum();
 
         if(this->isIntegerSolution(this->solver->getSolution())) {
             this->foundSolution = true;
+            this->status = OPTIMAL;
             this->optimum = this->solver->getOptimum();
             this->solution = this->solver->getSolution();
             break;
         }
 
-        if(!gomoryCut(this->solver->getTableau())) {
+        if(this->limits != NULL && this->limits->isReached()) {
+            this->status = LIMIT_REACHED;
             break;
         }
 
-        this->solver = new Simplex(this->mode, ilp->getObjectiveFunction(), ilp->getConstraints(), ilp->getRelations(), this->cuts);
+        bound = this->solver->getOptimum();
+        if(!this->separate()) {
+            this->status = STALLED;
+            break;
+        }
+        this->rounds++;
+
+        //os cortes entram no tableau ótimo e a viabilidade volta com alguns pivôs do Simplex dual
+        this->solver->reoptimize();
+
+        //cortes com folga há várias rodadas saem do PL, que continua ótimo
+        if(this->solver->hasSolution()) {
+            this->registerImprovement(fabs(this->solver->getOptimum() - bound));
+            removed = this->pool->age(this->solver->getSolution());
+            for(size_t i = 0; i < removed.size(); i++) {
+                if(!this->solver->removeCut(removed[i]->id)) {
+                    removed[i]->active = true;
+                }
+            }
+        }
     }
 }
 
 /**
- * @desc Função para realizar o corte no espaço de solução
- * @param MatrixXd contém o tableau a ser realizado o corte
- * @returns bool true se o corte foi inserido ou false se inválido
+ * @desc Destrutor
  */
-bool CuttingPlane::gomoryCut(MatrixXd tableau) {
-    double intPart, floatPart;
-    long long j, rowToCut;
-    VectorXd cut = VectorXd::Zero(tableau.cols());
-
-    rowToCut = getCutRow(tableau);
-    if(rowToCut == -1) {
-        return false;
+CuttingPlane::~CuttingPlane() {
+    delete this->solver;
+    delete this->pool;
+    for(size_t k = 0; k < this->separators.size(); k++) {
+        delete this->separators[k];
     }
-
-    for (j = 0; j < tableau.cols(); j++) {
-        if(tableau(rowToCut,j) >= 0 ) {
-            cut(j) = modf(tableau(rowToCut,j), &intPart);
-        } else {
-            floatPart = modf(tableau(rowToCut,j), &intPart);
-            if(floatPart != 0){
-                cut(j) = 1 + floatPart;
-            } else {
-                cut(j) = 0;
-            }
-        }
-    }
-
-    addCut(cut);
-
-    return true;
 }
 
 /**
- * @desc Função para retornar a linha a ser realizado o corte
- * @param MatrixXd contém o tableau a ser realizado o corte
- * @returns long long a linha a ser realizado o corte
+ * @desc Rodada de separação: todos os separadores geram cortes violados pelo ponto atual,
+ * @desc o pool filtra os repetidos e insere no PL os mais eficazes
+ *
+ * @returns bool true se algum corte foi inserido
  */
-long long CuttingPlane::getCutRow(MatrixXd tableau) {
-    double intPart;
-    long long i, j, row = -1;
-
-    //busca linha a ser realizado o corte
-    for (j = 0; j < this->numberOfVariables; j++) {
-        for (i = 1; i < tableau.rows(); i++) {
-            if (tableau(i, j) == 1) {
-                if (row >= 0) {
-                    row = -1;
-                    break;
-                } else {
-                    row = i;
-                    continue;
-                }
-            } else if (tableau(i, j) != 0) {
-                row = -1;
-                break;
-            }
+bool CuttingPlane::separate() {
+    VectorXd point = this->solver->getSolution();
+    vector<SparseVector<double> > cuts;
+    vector<Cut*> selected;
+
+    for(size_t k = 0; k < this->separators.size(); k++) {
+        cuts.clear();
+        this->separators[k]->run(this->solver, point, cuts);
+        for(size_t i = 0; i < cuts.size(); i++) {
+            this->pool->add(cuts[i], point, k);
         }
-        if(row != -1
-                && modf(tableau(row, tableau.cols()-1), &intPart) > 0.00001
-                && modf(tableau(row, tableau.cols()-1), &intPart) < 0.99) {
-            break;
-        }
-        row = -1;
     }
 
-    return row;
+    this->roundCuts.assign(this->separators.size(), 0);
+    selected = this->pool->select(point, MAX_CUTS_PER_ROUND);
+    for(size_t i = 0; i < selected.size(); i++) {
+        this->solver->addCut(selected[i]->constraint, selected[i]->id);
+        this->separators[selected[i]->family]->registerApplied(1);
+        this->roundCuts[selected[i]->family]++;
+    }
+    this->appliedCuts += selected.size();
+
+    return !selected.empty();
 }
 
 /**
- * @desc Função para adicionar o novo corte a matriz de cortes
- * @param VectorXd corte a ser adicionado
+ * @desc Divide a melhora do limite na rodada entre as famílias, proporcionalmente aos cortes
+ * @desc de cada uma inseridos na rodada
+ *
+ * @param double improvement melhora do valor da relaxação
  * @returns void
  */
-void CuttingPlane::addCut(VectorXd cut) {
-    this->cuts.conservativeResize(this->cuts.rows()+1, cut.rows());
-    this->cuts.col(this->cuts.cols()-1) = this->cuts.col(this->cuts.cols()-2);
-    this->cuts.col(this->cuts.cols()-2) = VectorXd::Zero(this->cuts.rows());
-    this->cuts.row(this->cuts.rows()-1) = cut;
+void CuttingPlane::registerImprovement(double improvement) {
+    long long total = 0;
+
+    for(size_t k = 0; k < this->roundCuts.size(); k++) {
+        total += this->roundCuts[k];
+    }
+    for(size_t k = 0; k < this->roundCuts.size() && total > 0; k++) {
+        this->separators[k]->registerImprovement(improvement * this->roundCuts[k] / total);
+    }
 }
 
 /**
- * @desc Função para verificar se a solução é inteira
+ * @desc Função para verificar se a solução é inteira (só nas variáveis inteiras)
  * @param VectorXd contém a solução a ser verificada
  * @returns bool true se for a solução é inteira
  */
 bool CuttingPlane::isIntegerSolution(VectorXd solution) {
-    double intPart;
+    //distância ao inteiro mais próximo (vale também para valores negativos)
     for (long long i = 0; i < solution.rows(); i++) {
-        if(modf(solution(i), &intPart) > 0.00001 && modf(solution(i), &intPart) < 0.99) {
+        if(this->ilp->isInteger(i) && fabs(solution(i) - round(solution(i))) > 0.00001) {
             return false;
         }
     }
@@ -143,6 +168,25 @@ bool CuttingPlane::hasSolution() {
     return this->foundSolution;
 }
 
+/**
+ * @desc Retorna a situação do resultado: OPTIMAL, INFEASIBLE, UNBOUNDED, LIMIT_REACHED ou STALLED
+ *
+ * @returns int
+ */
+int CuttingPlane::getStatus() {
+    return this->status;
+}
+
+/**
+ * @desc Retorna o último valor da relaxação com cortes, um limite dual válido mesmo quando a
+ * @desc separação é interrompida
+ *
+ * @returns double
+ */
+double CuttingPlane::getDualBound() {
+    return this->dualBound;
+}
+
 /**
  * @desc Retorna o valor ótimo da funcao objetivo maximizado ou minimizado com valores inteiros
  *
@@ -160,3 +204,30 @@ double CuttingPlane::getOptimum() {
 VectorXd CuttingPlane::getSolution() {
     return this->solution;
 }
+
+/**
+ * @desc Retorna o número de rodadas de separação
+ *
+ * @returns long long
+ */
+long long CuttingPlane::getRounds() {
+    return this->rounds;
+}
+
+/**
+ * @desc Retorna o número de cortes inseridos no PL
+ *
+ * @returns long long
+ */
+long long CuttingPlane::getAppliedCuts() {
+    return this->appliedCuts;
+}
+
+/**
+ * @desc Retorna os separadores, com as estatísticas de cada família de cortes
+ *
+ * @returns vector<Separator*>
+ */
+vector<Separator*> CuttingPlane::getSeparators() {
+    return this->separators;
+}
@@ -0,0 +1,154 @@
+#include "../headers/GomorySeparator.h"
+#include <Eigen>
+#include <cmath>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ */
+GomorySeparator::GomorySeparator(Problem *ilp) : Separator(ilp, "Gomory") {
+}
+
+/**
+ * @desc Os cortes de Gomory vêm do tableau, escrito com os limites da relaxação atual
+ *
+ * @returns bool true
+ */
+bool GomorySeparator::isLocal() {
+    return true;
+}
+
+/**
+ * @desc Gera um corte de Gomory para cada uma das GOMORY_ROWS linhas mais fracionárias do
+ * @desc tableau e o reescreve nas variáveis originais
+ *
+ * @param LPSolver *solver relaxação resolvida (precisa ser o Simplex tableau)
+ * @param const VectorXd &point solução da relaxação (não usada, as linhas vêm do tableau)
+ * @param vector<SparseVector<double> > &cuts recebe os cortes
+ * @returns void
+ */
+void GomorySeparator::separate(LPSolver *solver, const VectorXd &, vector<SparseVector<double> > &cuts) {
+    Simplex *simplex = dynamic_cast<Simplex*>(solver);
+    MatrixXd tableau;
+    vector<long long> rows;
+
+    if(simplex == NULL) {
+        return;
+    }
+    tableau = simplex->getTableau();
+    rows = this->getCutRows(tableau);
+    for(size_t i = 0; i < rows.size(); i++) {
+        cuts.push_back(simplex->getOriginalCut(this->gomoryCut(simplex, tableau, rows[i])));
+    }
+}
+
+/**
+ * @desc Função para gerar o corte de Gomory de uma linha do tableau. Se todas as colunas da
+ * @desc linha são inteiras, gera o corte fracionário; se a linha tem colunas contínuas (folgas
+ * @desc de cortes com coeficientes fracionários, como MIR e cobertura), o corte fracionário não
+ * @desc vale mais e é gerado o corte de Gomory misto-inteiro.
+ * @param Simplex *simplex relaxação com o tableau
+ * @param MatrixXd tableau tableau ótimo
+ * @param long long rowToCut linha com variável básica fracionária
+ * @returns VectorXd corte (>=) nas colunas do tableau, o último é o lado direito
+ */
+VectorXd GomorySeparator::gomoryCut(Simplex *simplex, const MatrixXd &tableau, long long rowToCut) {
+    long long constantColumn = tableau.cols() - 1;
+    double fraction, value;
+    double rhsFraction = tableau(rowToCut, constantColumn) - floor(tableau(rowToCut, constantColumn));
+    bool integral = true;
+    VectorXd cut = VectorXd::Zero(tableau.cols());
+
+    for (long long j = 0; j < constantColumn && integral; j++) {
+        integral = fabs(tableau(rowToCut, j)) < FRACTION_TOLERANCE || simplex->isIntegerColumn(j);
+    }
+
+    //o tableau vivo acumula erros de arredondamento: valores muito próximos de um inteiro contam como inteiros
+    if (integral) {
+        for (long long j = 0; j < tableau.cols(); j++) {
+            fraction = tableau(rowToCut, j) - floor(tableau(rowToCut, j));
+            if (fraction < FRACTION_TOLERANCE || fraction > 1 - FRACTION_TOLERANCE) {
+                cut(j) = 0;
+            } else {
+                cut(j) = fraction;
+            }
+        }
+        return cut;
+    }
+
+    for (long long j = 0; j < constantColumn; j++) {
+        value = tableau(rowToCut, j);
+        if (simplex->isIntegerColumn(j)) {
+            fraction = value - floor(value);
+            if (fraction < FRACTION_TOLERANCE || fraction > 1 - FRACTION_TOLERANCE) {
+                cut(j) = 0;
+            } else if (fraction <= rhsFraction) {
+                cut(j) = fraction;
+            } else {
+                cut(j) = rhsFraction * (1 - fraction) / (1 - rhsFraction);
+            }
+        } else if (fabs(value) < FRACTION_TOLERANCE) {
+            cut(j) = 0;
+        } else if (value > 0) {
+            cut(j) = value;
+        } else {
+            cut(j) = -value * rhsFraction / (1 - rhsFraction);
+        }
+    }
+    cut(constantColumn) = rhsFraction;
+
+    return cut;
+}
+
+/**
+ * @desc Função para retornar as linhas a serem realizados os cortes: linhas de variáveis
+ * @desc originais inteiras básicas com valor fracionário, das mais fracionárias para as menos
+ * @param MatrixXd contém o tableau a ser realizado o corte
+ * @returns vector<long long> no máximo GOMORY_ROWS linhas
+ */
+vector<long long> GomorySeparator::getCutRows(const MatrixXd &tableau) {
+    vector<pair<double, long long> > candidates;
+    vector<long long> rows;
+    double intPart, fraction;
+    long long i, j, row;
+
+    //busca linhas a serem realizados os cortes
+    for (j = 0; j < this->numberOfVariables; j++) {
+        //variáveis contínuas podem ficar fracionárias
+        if (!this->ilp->isInteger(j)) {
+            continue;
+        }
+        row = -1;
+        for (i = 1; i < tableau.rows(); i++) {
+            if (fabs(tableau(i, j) - 1) < FRACTION_TOLERANCE) {
+                if (row >= 0) {
+                    row = -1;
+                    break;
+                } else {
+                    row = i;
+                    continue;
+                }
+            } else if (fabs(tableau(i, j)) >= FRACTION_TOLERANCE) {
+                row = -1;
+                break;
+            }
+        }
+        if(row == -1) {
+            continue;
+        }
+        fraction = modf(tableau(row, tableau.cols()-1), &intPart);
+        if(fraction > 0.00001 && fraction < 0.99999) {
+            candidates.push_back(make_pair(fabs(fraction - 0.5), row));
+        }
+    }
+
+    sort(candidates.begin(), candidates.end());
+    for(size_t k = 0; k < candidates.size() && k < GOMORY_ROWS; k++) {
+        rows.push_back(candidates[k].second);
+    }
+    return rows;
+}
@@ -0,0 +1,92 @@
+#include "../headers/Incumbent.h"
+
+/**
+ * @desc Construtor
+ *
+ * @param int mode Pode ser: MINIMIZE, MAXIMIZE
+ */
+Incumbent::Incumbent(int mode) {
+    this->mode = mode;
+    this->found = false;
+    this->value = 0;
+    this->version = 0;
+}
+
+/**
+ * @desc Oferece uma solução inteira: ela substitui a atual se for melhor
+ *
+ * @param const VectorXd &solution
+ * @param double value valor da solução
+ * @returns bool true se a solução foi aceita
+ */
+bool Incumbent::offer(const VectorXd &solution, double value) {
+    lock_guard<mutex> guard(this->lock);
+
+    if(this->found && ((this->mode == MAXIMIZE) ? value <= this->value : value >= this->value)) {
+        return false;
+    }
+    this->found = true;
+    this->solution = solution;
+    this->value = value;
+    this->version++;
+    return true;
+}
+
+/**
+ * @desc Copia a solução atual
+ *
+ * @param VectorXd &solution recebe a solução
+ * @param double &value recebe o valor
+ * @param long long &version recebe a versão copiada
+ * @returns bool false se ainda não há solução
+ */
+bool Incumbent::get(VectorXd &solution, double &value, long long &version) {
+    lock_guard<mutex> guard(this->lock);
+
+    version = this->version;
+    if(!this->found) {
+        return false;
+    }
+    solution = this->solution;
+    value = this->value;
+    return true;
+}
+
+/**
+ * @desc Retorna a versão atual (número de melhoras)
+ *
+ * @returns long long
+ */
+long long Incumbent::getVersion() {
+    return this->version;
+}
+
+/**
+ * @desc Verifica se alguma solução foi encontrada
+ *
+ * @returns bool
+ */
+bool Incumbent::hasSolution() {
+    lock_guard<mutex> guard(this->lock);
+    return this->found;
+}
+
+/**
+ * @desc Retorna o valor da melhor solução
+ *
+ * @returns double
+ */
+double Incumbent::getValue() {
+    lock_guard<mutex> guard(this->lock);
+    return this->value;
+}
+
+/**
+ * @desc Retorna a melhor solução
+ *
+ * @returns VectorXd
+ */
+VectorXd Incumbent::getSolution() {
+    lock_guard<mutex> guard(this->lock);
+    return this->solution;
+}
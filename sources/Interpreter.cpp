@@ -1,621 +1,242 @@
 #include "../headers/Interpreter.h"
+#include "../headers/Parser.h"
+#include "../headers/MpsParser.h"
+#include "../headers/Snapshot.h"
 #include "../headers/Exception.h"
-#include <unordered_map>
+#include <chrono>
+#include <thread>
+#include <iterator>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace Eigen;
 
 /**
- * @desc Construtor
+ * @desc Construtor: mapeia o arquivo em memória (ou, se não for possível, o carrega inteiro) e o
+ * @desc interpreta em uma passada (snapshot binário, reconhecido pelo conteúdo; extensão .lp: formato lp;
+ * @desc .mps: MPS livre ou, se ele falhar, MPS fixo; outras: formato livre)
  *
  * @param string fileName nome do arquivo a ser lido a entrada
+ * @param int numberOfThreads threads da interpretação (0 para uma por núcleo)
  * @returns Interpreter
  */
-Interpreter::Interpreter(const string fileName) {
-    //abre o arquivo
-    this->in.open(fileName.c_str());
+Interpreter::Interpreter(const string fileName, int numberOfThreads) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    const char *data = NULL;
+    struct stat status;
+    string buffer;
+    int descriptor;
 
-    if(!this->in.is_open()) {
-        throw(new Exception("Interpreter: Nao foi possivel abrir o arquivo de entrada!"));
+    if(numberOfThreads < 1) {
+        numberOfThreads = max((int) thread::hardware_concurrency(), 1);
     }
 
-    if(fileName.length() > 3 && fileName.substr(fileName.length()-3, fileName.length()) != ".lp") {
-        this->readFile();
-    } else {
-        this->readLPFile();
+    descriptor = open(fileName.c_str(), O_RDONLY);
+    if(descriptor < 0 || fstat(descriptor, &status) != 0) {
+        if(descriptor >= 0) {
+            close(descriptor);
+        }
+        throw(new Exception("Interpreter: Nao foi possivel abrir o arquivo de entrada!"));
     }
+    this->bytes = status.st_size;
 
-    this->pli = new Problem(this->objectiveFunction, this->constraints, this->relations);
-
-    this->in.close();
-}
-
-/**
- * @desc Método para ler o arquivo no formato livre
- *
- * @returns void
- */
-void Interpreter::readFile() {
-    long long lineNumber = 1;
-    string line;
-    ostringstream ss;
-
-    //lê a primeira linha
-    getline(this->in,line);
+    //as páginas são lidas sob demanda pelas threads da interpretação
+    if(this->bytes > 0 && S_ISREG(status.st_mode)) {
+        data = (const char*) mmap(NULL, this->bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if(data == MAP_FAILED) {
+            data = NULL;
+        } else {
+            madvise((void*) data, this->bytes, MADV_WILLNEED);
+        }
+    }
+    close(descriptor);
 
-    //interpreta a primeira linha que contém a função objetivo e modo
-    this->getObjectiveAndMode(line);
+    if(data == NULL) {
+        //uma leitura só, do tamanho do arquivo
+        ifstream in(fileName.c_str(), ios::in | ios::binary);
+        if(!in.is_open()) {
+            throw(new Exception("Interpreter: Nao foi possivel abrir o arquivo de entrada!"));
+        }
+        buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+        in.close();
+        this->bytes = buffer.size();
+    }
+    this->readTime = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
 
-    //lê o restante das linhas contendo as restrições
-    while(getline(in,line)) {
-        //realoca a matriz de restrição e vetor de relação para receber a nova restrição
-        this->constraints.conservativeResize(lineNumber,this->objectiveFunction.rows()+1);
-        this->constraints.row(this->constraints.rows()-1) = VectorXd::Zero(this->objectiveFunction.rows()+1);
-        this->relations.conservativeResize(lineNumber);
-        //interpreta a linha e busca a restrição
-        if(!this->getConstraint(line)) {
-            ss << lineNumber+1;
-            string message = "Interpreter: Erro na linha " + ss.str() + "!";
-            throw(new Exception(message));
+    start = chrono::steady_clock::now();
+    try {
+        if(data != NULL) {
+            this->parse(fileName, data, data + this->bytes, numberOfThreads);
+        } else {
+            this->parse(fileName, buffer.data(), buffer.data() + buffer.size(), numberOfThreads);
+        }
+    } catch(Exception *ex) {
+        if(data != NULL) {
+            munmap((void*) data, this->bytes);
         }
-        lineNumber++;
+        throw(ex);
+    }
+    if(data != NULL) {
+        munmap((void*) data, this->bytes);
     }
+    this->parseTime = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
 }
 
 /**
- * @desc Método para encontrar função objetivo e modo na string passada como parâmetro
+ * @desc Interpreta o conteúdo com o leitor do formato do arquivo
  *
- * @param string line a primeira linha do arquivo contendo a função objetiva e o modo
+ * @param const string &fileName nome do arquivo (define o formato)
+ * @param const char *begin início do conteúdo
+ * @param const char *end fim do conteúdo
+ * @param int numberOfThreads
  * @returns void
  */
-void Interpreter::getObjectiveAndMode(string line) {
-    string temp;
-    long long counter, i;
-    double variable;
-    unordered_map<long long, double> variables;
-    char op = '+';
-    bool waitDigit = true;
-    bool waitX = true;
-    bool waitOperator = false;
-    bool waitPos = false;
-
-    //remove espaços
-    line.erase(std::remove(line.begin(),line.end(),' '),line.end());
-
-    temp = line.substr(0,3);
-
-    //transforma para maiusculo
-    transform(temp.begin(), temp.end(), temp.begin(), ::toupper);
-
-    if(temp == "MAX") {
-        this->mode = 2;
-    } else if(temp == "MIN") {
-        this->mode = 1;
-    } else {
-        throw(new Exception("Interpreter: Nao encontrado modo (Maximizar ou Minimizar) da fun��o objetivo!"));
-    }
-
-    //começa da posição 6, pois se assume as 5 primeiras sendo MINZ= ou MAXZ=
-    counter = 5;
-    variable = 1;
-
-    if(line[counter]=='-') {
-        op = '-';
-        counter++;
-        variable = -variable;
-    }
-
-    for (i=counter;i<line.length();i++){
-        temp = line.substr(counter,i-counter+1);
-        if(waitDigit && isdigit(line[i]) && (!isdigit(line[i+1]) && line[i+1] != '.')) {
-            variable = atof(temp.c_str());
-            counter=i+1;
-            waitDigit = false;
-            continue;
-        } else if(waitX && toupper(line[i])=='X') {
-            counter=i+1;
-            waitX = false;
-            waitDigit = false;
-            waitPos = true;
-            continue;
-        } else if(i+1==line.length() || (waitPos && isdigit(line[i]) && !isdigit(line[i+1]))) {
-            if(!waitPos || waitX) {
-                throw(new Exception("Interpreter: Erro ao interpretar a funcao objetivo!"));
-            }
-            if(op == '-') {
-               variable = -variable;
-            }
-            variables[atoll(temp.c_str())] = variable;
-            variable = 1;
-            counter=i+1;
-            waitOperator = true;
-            waitPos=false;
-            continue;
-        } else if(waitOperator && (line[i]=='+' || line[i]=='-')) {
-            op = line[i];
-            counter=i+1;
-            waitOperator = false;
-            waitDigit=true;
-            waitX = true;
+void Interpreter::parse(const string &fileName, const char *begin, const char *end, int numberOfThreads) {
+    Parser *parser;
+    MpsParser *mpsParser;
+    Snapshot *snapshot;
+    Exception *freeError;
+    int format;
+
+    this->objectiveOffset = 0;
+    this->chunks = 1;
+
+    if(Snapshot::isSnapshot(begin, end)) {
+        snapshot = new Snapshot(begin, end);
+        this->pli = snapshot->getProblem();
+        this->mode = snapshot->getMode();
+        this->lines = 0;
+        this->nonzeros = snapshot->getNonzeros();
+        this->objectiveOffset = snapshot->getObjectiveOffset();
+        delete snapshot;
+        return;
+    }
+
+    if(fileName.length() > 4 && fileName.substr(fileName.length()-4) == ".mps") {
+        try {
+            mpsParser = new MpsParser(begin, end, MPS_FREE);
+        } catch(Exception *ex) {
+            //nomes com espaços só existem no formato fixo; se ele também falhar, vale o erro do livre
+            freeError = ex;
+            try {
+                mpsParser = new MpsParser(begin, end, MPS_FIXED);
+            } catch(Exception *fixedError) {
+                delete fixedError;
+                throw(freeError);
+            }
+            delete freeError;
         }
+        this->pli = mpsParser->getProblem();
+        this->mode = mpsParser->getMode();
+        this->lines = mpsParser->getLines();
+        this->nonzeros = mpsParser->getNonzeros();
+        this->objectiveOffset = mpsParser->getObjectiveOffset();
+        delete mpsParser;
+        return;
     }
 
-    this->objectiveFunction.resize(variables.size());
-
-    for(i=0; i<this->objectiveFunction.rows(); i++) {
-        this->objectiveFunction(i) = variables[i+1];
+    if(fileName.length() > 3 && fileName.substr(fileName.length()-3, fileName.length()) != ".lp") {
+        format = FREE_FORMAT;
+    } else {
+        format = LP_FORMAT;
     }
 
+    parser = new Parser(begin, end, format, numberOfThreads);
+    this->pli = parser->getProblem();
+    this->mode = parser->getMode();
+    this->lines = parser->getLines();
+    this->nonzeros = parser->getNonzeros();
+    this->chunks = parser->getChunks();
+    delete parser;
 }
 
- /**
- * @desc Método para buscar uma restrição da PLI a partir da string passada
- *
- * @param string line linha do arquivo contendo a restrição
- * @returns bool true se conseguiu obter a restrição
+/**
+ * @desc Destrutor: libera o problema lido
  */
-bool Interpreter::getConstraint(string line) {
-     string temp;
-     long long counter, i;
-     double variable;
-     unordered_map<long long, double> variables;
-     char op = '+';
-     int relation;
-     bool waitDigit = true;
-     bool waitX = true;
-     bool waitOperator = false;
-     bool waitPos = false;
-
-     //remove espaços
-     line.erase(std::remove(line.begin(),line.end(),' '),line.end());
-
-     counter = 0;
-     variable = 1;
-
-     if(line[counter]=='-') {
-         op = '-';
-         counter++;
-         variable = -variable;
-     }
-
-     for (i=counter;i<line.length();i++){
-         temp = line.substr(counter,i-counter+1);
-         if(waitDigit && isdigit(line[i]) && (!isdigit(line[i+1]) && line[i+1] != '.') && i+1!=line.length()) {
-             variable = atof(temp.c_str());
-             counter=i+1;
-             waitDigit = false;
-             continue;
-         } else if(waitX && toupper(line[i])=='X') {
-             counter=i+1;
-             waitX = false;
-             waitDigit = false;
-             waitPos = true;
-             continue;
-         } else if(waitPos && isdigit(line[i]) && !isdigit(line[i+1]) && i+1!=line.length()) {
-             if(op == '-') {
-                 variable = -variable;
-             }
-             variables[atoll(temp.c_str())] = variable;
-             variable = 1;
-             counter=i+1;
-             waitOperator = true;
-             waitPos=false;
-             continue;
-         } else if(waitOperator && (line[i]=='+' || line[i]=='-') && i+1!=line.length()) {
-             op = line[i];
-             counter=i+1;
-             waitOperator = false;
-             waitDigit=true;
-             waitX = true;
-             continue;
-         } else if((line[i]=='>' || line[i]=='=' || line[i]=='<') && i+1!=line.length()) {
-             if(!waitOperator) {
-                 return false;
-             }
-             switch(line[i]) {
-                 case '>':
-                     relation = 1;
-                     break;
-                 case '=':
-                     relation = 2;
-                     break;
-                 case '<':
-                     relation = 0;
-                     break;
-             }
-             if(line[i+1] == '=') {
-                 i++;
-             }
-             if(line[i+2] == '-') {
-                 op = '-';
-                 i++;
-             } else {
-                 op = '+';
-             }
-             counter=i+1;
-             waitOperator = false;
-             continue;
-         } else if(i+1==line.length()) {
-             if(waitOperator || waitDigit || waitPos || waitX) {
-                 return false;
-             }
-             variable = atof(temp.c_str());
-             if(op == '-') {
-                 variable = -variable;
-             }
-             variables[this->objectiveFunction.rows()+1] = variable;
-         }
-     }
-
-     for(i=0; i<this->constraints.cols(); i++) {
-         if(variables.find(i+1) != variables.end()) {
-             this->constraints(this->constraints.rows()-1, i) = variables[i+1];
-         }
-     }
-
-     this->relations(this->relations.rows()-1) = relation;
-
-     return true;
+Interpreter::~Interpreter() {
+    delete this->pli;
 }
 
 /**
- * @desc Método para ler o arquivo no formato lp
+ * @desc Método para retornar o problema encontrado
  *
- * @returns void
+ * @returns Problem
  */
-void Interpreter::readLPFile() {
-    long long lineNumber = 1;
-    string line;
-    ostringstream ss;
-    bool error, constraints = true;
-
-    //lê a primeira linha
-    getline(this->in,line);
-
-    //interpreta a primeira e segunda linha que contém a função objetivo e modo
-    this->getLPObjectiveAndMode(line);
-
-    //a terceira linha deve ser Subject To
-    getline(in,line);
-
-    //lê o restante das linhas contendo as restrições
-    while(getline(in,line)) {
-        //remove espaços
-        line.erase(std::remove(line.begin(),line.end(),' '),line.end());
-
-        if(line == "Bounds") {
-            constraints = false;
-            lineNumber++;
-            continue;
-        } else if(line == "Generals") {
-            break;
-        }
-
-        if(constraints){
-            //realoca a matriz de restrição e vetor de relação para receber a nova restrição
-            this->constraints.conservativeResize(lineNumber,this->objectiveFunction.rows()+1);
-            this->constraints.row(this->constraints.rows()-1) = VectorXd::Zero(this->objectiveFunction.rows()+1);
-            this->relations.conservativeResize(lineNumber);
-            error = !this->getLPConstraint(line);
-        } else {
-            error = !this->getLPBound(line);
-        }
-
-        if(error) {
-            ss << lineNumber+1;
-            string message = "Interpreter: Erro na linha " + ss.str() + "!";
-            throw(new Exception(message));
-        }
-
-        lineNumber++;
-    }
-
+Problem* Interpreter::getProblem() {
+    return this->pli;
 }
 
-
 /**
- * @desc Método para encontrar função objetivo e modo do formato lp
+ * @desc Método para retornar o modo (Maximização ou Minimização)
  *
- * @param string line a primeira e segunda linha do arquivo contendo o modo e a função objetiva
- * @returns void
+ * @returns int
  */
-void Interpreter::getLPObjectiveAndMode(string line) {
-    string temp;
-    long long counter, i;
-    double variable;
-    unordered_map<long long, double> variables;
-    char op = '+';
-    bool waitDigit = true;
-    bool waitX = true;
-    bool waitOperator = false;
-    bool waitPos = false;
-
-    //remove espaços
-    line.erase(std::remove(line.begin(),line.end(),' '),line.end());
-
-    //transforma para maiusculo
-    transform(line.begin(), line.end(), line.begin(), ::toupper);
-
-    if(line == "MAXIMIZE") {
-        this->mode = 2;
-    } else if(line == "MINIMIZE") {
-        this->mode = 1;
-    } else {
-        throw(new Exception("Interpreter: Nao encontrado modo (Maximizar ou Minimizar) da funcao objetivo!"));
-    }
-
-    //lê a segunda linha
-    getline(this->in,line);
-
-    //remove espaços
-    line.erase(std::remove(line.begin(),line.end(),' '),line.end());
-
-    //começa da posição 5, pois se assume as 4 primeiras sendo 'obj:'
-    counter = 4;
-    variable = 1;
-
-    if(line[counter]=='-') {
-        op = '-';
-        counter++;
-        variable = -variable;
-    }
-
-    for (i=counter;i<line.length();i++){
-        temp = line.substr(counter,i-counter+1);
-        if(waitDigit && isdigit(line[i]) && (!isdigit(line[i+1]) && line[i+1] != '.')) {
-            variable = atof(temp.c_str());
-            counter=i+1;
-            waitDigit = false;
-            continue;
-        } else if(waitX && toupper(line[i])=='X') {
-            counter=i+1;
-            waitX = false;
-            waitDigit = false;
-            waitPos = true;
-            continue;
-        } else if(i+1==line.length() || (waitPos && isdigit(line[i]) && !isdigit(line[i+1]))) {
-            if(!waitPos || waitX) {
-                throw(new Exception("Interpreter: Erro ao interpretar a funcao objetivo!"));
-            }
-            if(op == '-') {
-               variable = -variable;
-            }
-            variables[atoll(temp.c_str())] = variable;
-            variable = 1;
-            counter=i+1;
-            waitOperator = true;
-            waitPos=false;
-            continue;
-        } else if(waitOperator && (line[i]=='+' || line[i]=='-')) {
-            op = line[i];
-            counter=i+1;
-            waitOperator = false;
-            waitDigit=true;
-            waitX = true;
-        }
-    }
-
-    this->objectiveFunction.resize(variables.size());
-
-    for(i=0; i<this->objectiveFunction.rows(); i++) {
-        this->objectiveFunction(i) = variables[i+1];
-    }
+int Interpreter::getMode() {
+    return this->mode;
 }
 
 /**
-* @desc Método para buscar uma restrição da PLI no formato lp
-*
-* @param string line linha do arquivo contendo a restrição, sem espaços
-* @returns bool true se conseguiu obter a restrição
-*/
-bool Interpreter::getLPConstraint(string line) {
-    string temp;
-    long long counter, i;
-    double variable;
-    unordered_map<long long, double> variables;
-    char op = '+';
-    int relation;
-    bool waitDigit = true;
-    bool waitX = true;
-    bool waitOperator = false;
-    bool waitPos = false;
-
-    //busca o valor inicial do counter
-    for (i=0;i<line.length();i++){
-        if(line[i] == ':') {
-            break;
-        }
-    }
-
-    counter = i+1;
-    variable = 1;
-
-    if(line[counter]=='-') {
-        op = '-';
-        counter++;
-        variable = -variable;
-    }
-
-    for (i=counter;i<line.length();i++){
-        temp = line.substr(counter,i-counter+1);
-        if(waitDigit && isdigit(line[i]) && (!isdigit(line[i+1]) && line[i+1] != '.') && i+1!=line.length()) {
-            variable = atof(temp.c_str());
-            counter=i+1;
-            waitDigit = false;
-            continue;
-        } else if(waitX && toupper(line[i])=='X') {
-            counter=i+1;
-            waitX = false;
-            waitDigit = false;
-            waitPos = true;
-            continue;
-        } else if(waitPos && isdigit(line[i]) && !isdigit(line[i+1]) && i+1!=line.length()) {
-            if(op == '-') {
-                variable = -variable;
-            }
-            variables[atoll(temp.c_str())] = variable;
-            variable = 1;
-            counter=i+1;
-            waitOperator = true;
-            waitPos=false;
-            continue;
-        } else if(waitOperator && (line[i]=='+' || line[i]=='-') && i+1!=line.length()) {
-            op = line[i];
-            counter=i+1;
-            waitOperator = false;
-            waitDigit=true;
-            waitX = true;
-            continue;
-        } else if((line[i]=='>' || line[i]=='=' || line[i]=='<') && i+1!=line.length()) {
-            if(!waitOperator) {
-                return false;
-            }
-            switch(line[i]) {
-                case '>':
-                    relation = 1;
-                    break;
-                case '=':
-                    relation = 2;
-                    break;
-                case '<':
-                    relation = 0;
-                    break;
-            }
-            if(line[i+1] == '=') {
-                i++;
-            }
-            if(line[i+2] == '-') {
-                op = '-';
-                i++;
-            } else {
-                op = '+';
-            }
-            counter=i+1;
-            waitOperator = false;
-            continue;
-        } else if(i+1==line.length()) {
-            if(waitOperator || waitDigit || waitPos || waitX) {
-                return false;
-            }
-            variable = atof(temp.c_str());
-            if(op == '-') {
-                variable = -variable;
-            }
-            variables[this->objectiveFunction.rows()+1] = variable;
-        }
-    }
-
-    for(i=0; i<this->constraints.cols(); i++) {
-        if(variables.find(i+1) != variables.end()) {
-            this->constraints(this->constraints.rows()-1, i) = variables[i+1];
-        }
-    }
-
-    this->relations(this->relations.rows()-1) = relation;
-
-    return true;
+ * @desc Retorna o tamanho do arquivo em bytes
+ *
+ * @returns long long
+ */
+long long Interpreter::getBytes() {
+    return this->bytes;
 }
 
 /**
-* @desc Método para buscar os limites da PLI no formato lp
-*
-* @param string line linha do arquivo contendo a restrição, sem espaços
-* @returns bool true se conseguiu obter a restrição
-*/
-bool Interpreter::getLPBound(string line) {
-    string temp;
-    long long counter, i, pos;
-    double variable;
-    int relation = -1;
-    bool waitDigit = true;
-    bool waitX = true;
-    bool waitPos = false;
+ * @desc Retorna o número de linhas do arquivo
+ *
+ * @returns long long
+ */
+long long Interpreter::getLines() {
+    return this->lines;
+}
 
-    counter = 0;
+/**
+ * @desc Retorna o número de coeficientes não nulos das restrições
+ *
+ * @returns long long
+ */
+long long Interpreter::getNonzeros() {
+    return this->nonzeros;
+}
 
-    for (i=0;i<line.length();i++){
-        temp = line.substr(counter,i-counter+1);
-        if(waitDigit && isdigit(line[i]) && (!isdigit(line[i+1]) && line[i+1] != '.') && i+1!=line.length()) {
-            variable = atof(temp.c_str());
-            counter=i+1;
-            waitDigit = false;
-            waitX = false;
-            continue;
-        } else if(waitX && toupper(line[i])=='X') {
-            counter=i+1;
-            waitX = false;
-            waitDigit = false;
-            waitPos = true;
-            continue;
-        } else if(waitPos && isdigit(line[i]) && !isdigit(line[i+1]) && i+1!=line.length()) {
-            pos = atoll(temp.c_str())-1;
-            if(relation != -1 && variable > 0) {
-                //realoca a matriz de restrição e vetor de relação para receber a nova restrição
-                this->constraints.conservativeResize(this->constraints.rows()+1,this->objectiveFunction.rows()+1);
-                this->constraints.row(this->constraints.rows()-1) = VectorXd::Zero(this->objectiveFunction.rows()+1);
-                this->relations.conservativeResize(this->relations.rows()+1);
-                this->constraints(this->constraints.rows()-1, pos) = 1;
-                this->constraints(this->constraints.rows()-1, this->constraints.cols()-1) = variable;
-                this->relations(this->relations.rows()-1) = relation;
-            } else {
-                relation = -2;
-            }
-            counter=i+1;
-            waitPos=false;
-            continue;
-        } else if((line[i]=='>' || line[i]=='=' || line[i]=='<') && i+1!=line.length()) {
-            if(relation == -1) {
-                waitX = true;
-            }
-            switch(line[i]) {
-                case '>':
-                    relation = 1;
-                    break;
-                case '=':
-                    relation = 2;
-                    break;
-                case '<':
-                    relation = 0;
-                    break;
-            }
-            if(line[i+1] == '=') {
-                i++;
-            }
-            counter=i+1;
-            continue;
-        } else if(i+1==line.length()) {
-            if(waitDigit || waitPos || waitX) {
-                return false;
-            }
-            variable = atof(temp.c_str());
-            if(variable > 0) {
-                //realoca a matriz de restrição e vetor de relação para receber a nova restrição
-                this->constraints.conservativeResize(this->constraints.rows()+1,this->objectiveFunction.rows()+1);
-                this->constraints.row(this->constraints.rows()-1) = VectorXd::Zero(this->objectiveFunction.rows()+1);
-                this->relations.conservativeResize(this->relations.rows()+1);
-                this->constraints(this->constraints.rows()-1, pos) = 1;
-                this->constraints(this->constraints.rows()-1, this->constraints.cols()-1) = variable;
-                this->relations(this->relations.rows()-1) = relation;
-            }
-        }
-    }
+/**
+ * @desc Retorna a constante da função objetivo (RHS do objetivo no MPS), somada ao valor ótimo
+ *
+ * @returns double
+ */
+double Interpreter::getObjectiveOffset() {
+    return this->objectiveOffset;
+}
 
-    return true;
+/**
+ * @desc Retorna em quantos blocos paralelos as restrições foram lidas
+ *
+ * @returns int
+ */
+int Interpreter::getChunks() {
+    return this->chunks;
 }
 
 /**
- * @desc Método para retornar o problema encontrado
+ * @desc Retorna o tempo de leitura do arquivo para a memória, em milissegundos (com o arquivo
+ * @desc mapeado, só o mapeamento: as páginas são lidas durante a interpretação)
  *
- * @returns Problem
+ * @returns double
  */
-Problem* Interpreter::getProblem() {
-    return this->pli;
+double Interpreter::getReadTime() {
+    return this->readTime;
 }
 
 /**
- * @desc Método para retornar o modo (Maximização ou Minimização)
+ * @desc Retorna o tempo de interpretação e montagem do problema, em milissegundos
  *
- * @returns int
+ * @returns double
  */
-int Interpreter::getMode() {
-    return this->mode;
+double Interpreter::getParseTime() {
+    return this->parseTime;
 }
@@ -0,0 +1,106 @@
+#include <Eigen>
+#include <cmath>
+#include "../headers/LPSolver.h"
+#include "../headers/Simplex.h"
+#include "../headers/RevisedSimplex.h"
+#include "../headers/Exception.h"
+
+using namespace Eigen;
+
+/**
+ * @desc Cria o método de resolução escolhido
+ *
+ * @param int engine Pode ser: TABLEAU_ENGINE, REVISED_ENGINE
+ * @param int mode Pode ser: SIMPLEX_MINIMIZE, SIMPLEX_MAXIMIZE
+ * @param Problem *problem problema com função objetivo, restrições, relações e limites das variáveis.
+ * @param Limits *limits orçamento consultado a cada pivô (NULL sem limites)
+ * @throw Exception caso o método não exista
+ * @returns LPSolver*
+ */
+LPSolver* LPSolver::create(int engine, int mode, Problem *problem, Limits *limits) {
+    if (engine == TABLEAU_ENGINE) {
+        return new Simplex(mode, problem, limits);
+    } else if (engine == REVISED_ENGINE) {
+        return new RevisedSimplex(mode, problem, limits);
+    }
+    throw(new Exception("LPSolver: metodo de resolucao invalido!"));
+}
+
+/**
+ * @desc Método para validar a entrada do solver
+ *
+ * @param os mesmos do método create
+ * @throw Exception caso a entrada seja inválida
+ * @returns void
+ */
+void LPSolver::isValidEntry(int mode, Problem *problem) {
+    VectorXd objectiveFunction = problem->getObjectiveFunction();
+    const SparseMatrixXd &constraints = problem->getConstraints();
+    VectorXd relations = problem->getRelations();
+    VectorXd lowerBounds = problem->getLowerBounds();
+    VectorXd upperBounds = problem->getUpperBounds();
+
+    if (mode != SIMPLEX_MINIMIZE && mode != SIMPLEX_MAXIMIZE) {
+        throw(new Exception("Simplex: modo invalido!."));
+    }
+
+    if (objectiveFunction.rows() < 1) {
+        throw(new Exception("Simplex: Deve conter pelo menos um coeficiente na funcao objetivo."));
+    }
+
+    if (constraints.rows() < 1) {
+        throw(new Exception("Simplex: Deve ter pelo menos uma restricao."));
+    }
+
+    if (constraints.cols() != objectiveFunction.rows() + 1) {
+        throw(new Exception("Simplex: numero de coeficientes da funcao objetivo diferente do número de coeficientes de restrição."));
+    }
+
+    if (relations.rows() != constraints.rows()) {
+        throw(new Exception("Simplex: numero de relacoes diferentes do numero de restricoes."));
+    }
+
+    if (lowerBounds.rows() != objectiveFunction.rows() || upperBounds.rows() != objectiveFunction.rows()) {
+        throw(new Exception("Simplex: numero de limites diferente do numero de variaveis."));
+    }
+
+    //as variáveis são deslocadas para o limite inferior, que precisa ser finito
+    for (long long i = 0; i < lowerBounds.rows(); i++) {
+        if (isinf(lowerBounds(i))) {
+            throw(new Exception("Simplex: Todo limite inferior deve ser finito."));
+        }
+    }
+}
+
+/**
+ * @desc Ajusta precisão do valor passado como parâmetro em 5 casas decimais
+ *
+ * @param double value valor a ser ajustado
+ * @returns double valor ajustado
+ */
+double LPSolver::adjustPrecision(double value) {
+    return (floor((value * pow(10, 5) + 0.5)) / pow(10, 5));
+}
+
+/**
+ * @desc Retorna a situação da última resolução: LP_OPTIMAL, LP_INFEASIBLE, LP_UNBOUNDED ou
+ * @desc LP_INTERRUPTED (um limite do orçamento foi atingido no meio dos pivôs)
+ *
+ * @returns int
+ */
+int LPSolver::getStatus() {
+    return this->status;
+}
+
+/**
+ * @desc Conta um pivô no orçamento e verifica se a resolução deve parar
+ *
+ * @returns bool true se um limite foi atingido (a situação passa a ser LP_INTERRUPTED)
+ */
+bool LPSolver::isInterrupted() {
+    if (this->limits != NULL && this->limits->addIteration()) {
+        this->status = LP_INTERRUPTED;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,143 @@
+#include "../headers/Limits.h"
+
+/**
+ * @desc Construtor: o relógio começa a contar aqui
+ *
+ * @param double timeLimit tempo máximo em segundos (NO_LIMIT sem limite)
+ * @param long long nodeLimit número máximo de nós explorados (NO_LIMIT sem limite)
+ * @param long long iterationLimit número máximo de pivôs somando todos os PLs (NO_LIMIT sem limite)
+ * @param long long memoryLimit memória máxima dos nós abertos em bytes (NO_LIMIT sem limite)
+ * @param Limits *parent orçamento que também limita este (NULL se não há)
+ */
+Limits::Limits(double timeLimit, long long nodeLimit, long long iterationLimit, long long memoryLimit, Limits *parent) {
+    this->timeLimit = timeLimit;
+    this->nodeLimit = nodeLimit;
+    this->iterationLimit = iterationLimit;
+    this->memoryLimit = memoryLimit;
+    this->start = chrono::steady_clock::now();
+    this->nodes = 0;
+    this->iterations = 0;
+    this->reason = NOT_REACHED;
+    this->parent = parent;
+}
+
+/**
+ * @desc Pede a interrupção da resolução (pode ser chamado de outra thread ou de um tratador de
+ * @desc sinal): os laços de pivôs e de nós param na próxima consulta
+ *
+ * @returns void
+ */
+void Limits::cancel() {
+    this->stop(CANCELLED);
+}
+
+/**
+ * @desc Verifica se algum limite foi atingido (o tempo é consultado a cada chamada); o motivo
+ * @desc da parada do pai passa a ser o motivo deste orçamento
+ *
+ * @returns bool
+ */
+bool Limits::isReached() {
+    if(this->reason == NOT_REACHED && this->timeLimit >= 0 && this->getElapsedTime() > this->timeLimit) {
+        this->stop(TIME_LIMIT);
+    }
+    if(this->reason == NOT_REACHED && this->parent != NULL && this->parent->isReached()) {
+        this->stop(this->parent->getReason());
+    }
+    return this->reason != NOT_REACHED;
+}
+
+/**
+ * @desc Conta um pivô no orçamento, chamado dentro dos laços do Simplex
+ *
+ * @returns bool true se a resolução deve parar
+ */
+bool Limits::addIteration() {
+    if(this->parent != NULL) {
+        this->parent->addIteration();
+    }
+    if(++this->iterations > this->iterationLimit && this->iterationLimit >= 0) {
+        this->stop(ITERATION_LIMIT);
+    }
+    return this->isReached();
+}
+
+/**
+ * @desc Conta um nó explorado no orçamento
+ *
+ * @returns bool true se a resolução deve parar
+ */
+bool Limits::addNode() {
+    if(this->parent != NULL) {
+        this->parent->addNode();
+    }
+    if(++this->nodes > this->nodeLimit && this->nodeLimit >= 0) {
+        this->stop(NODE_LIMIT);
+    }
+    return this->isReached();
+}
+
+/**
+ * @desc Compara a memória ocupada pelos nós abertos com o limite
+ *
+ * @param long long bytes memória atual
+ * @returns bool true se a resolução deve parar
+ */
+bool Limits::checkMemory(long long bytes) {
+    if(this->parent != NULL) {
+        this->parent->checkMemory(bytes);
+    }
+    if(this->memoryLimit >= 0 && bytes > this->memoryLimit) {
+        this->stop(MEMORY_LIMIT);
+    }
+    return this->isReached();
+}
+
+/**
+ * @desc Retorna o primeiro limite atingido (NOT_REACHED, TIME_LIMIT, NODE_LIMIT,
+ * @desc ITERATION_LIMIT, MEMORY_LIMIT ou CANCELLED)
+ *
+ * @returns int
+ */
+int Limits::getReason() {
+    return this->reason;
+}
+
+/**
+ * @desc Retorna o número de nós explorados contados no orçamento
+ *
+ * @returns long long
+ */
+long long Limits::getNodes() {
+    return this->nodes;
+}
+
+/**
+ * @desc Retorna o número de pivôs contados no orçamento (todos os PLs da resolução)
+ *
+ * @returns long long
+ */
+long long Limits::getIterations() {
+    return this->iterations;
+}
+
+/**
+ * @desc Retorna o tempo de relógio desde a criação, em segundos
+ *
+ * @returns double
+ */
+double Limits::getElapsedTime() {
+    return chrono::duration<double>(chrono::steady_clock::now() - this->start).count();
+}
+
+/**
+ * @desc Registra o motivo da interrupção (apenas o primeiro vale)
+ *
+ * @param int reason
+ * @returns void
+ */
+void Limits::stop(int reason) {
+    int expected = NOT_REACHED;
+
+    this->reason.compare_exchange_strong(expected, reason);
+}
@@ -0,0 +1,130 @@
+#include "../headers/MirSeparator.h"
+#include <Eigen>
+#include <cmath>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ */
+MirSeparator::MirSeparator(Problem *ilp) : Separator(ilp, "MIR") {
+}
+
+/**
+ * @desc Para cada linha a.x <= b: com x = l + x' ou x = u - x' (o limite mais próximo do ponto),
+ * @desc x' >= 0, divide a linha por d e aplica o arredondamento
+ * @desc sum(floor(a/d) + max(0, f(a/d) - f) / (1 - f)) x' <= floor(b/d), f = f(b/d), nas inteiras;
+ * @desc as contínuas ficam com min(0, a/d) / (1 - f) e não servem de divisor
+ *
+ * @param LPSolver *solver relaxação resolvida (não usada)
+ * @param const VectorXd &point solução da relaxação
+ * @param vector<SparseVector<double> > &cuts recebe os cortes
+ * @returns void
+ */
+void MirSeparator::separate(LPSolver *, const VectorXd &point, vector<SparseVector<double> > &cuts) {
+    const VectorXd &lower = this->lowerBounds;
+    const VectorXd &upper = this->upperBounds;
+    vector<long long> variables;
+    vector<double> coefficients, values, divisors;
+    vector<bool> complemented, integers;
+    VectorXd cut;
+    double rhs, divided, fraction, coefficient, coefficientFraction, violation, norm, bestViolation, bestDivisor, cutRhs;
+    long long j;
+    bool free;
+
+    for(size_t r = 0; r < this->rows.size(); r++) {
+        variables.clear();
+        coefficients.clear();
+        values.clear();
+        complemented.clear();
+        integers.clear();
+        divisors.clear();
+        rhs = this->rowsRhs[r];
+        free = false;
+
+        //substituição pelos limites: todos os coeficientes passam a multiplicar variáveis x' >= 0
+        for(SparseVector<double>::InnerIterator it(this->rows[r]); it; ++it) {
+            j = it.index();
+            variables.push_back(j);
+            integers.push_back(this->ilp->isInteger(j));
+            free = free || (isinf(lower(j)) && isinf(upper(j)));
+            if(isinf(upper(j)) || point(j) - lower(j) <= upper(j) - point(j)) {
+                complemented.push_back(false);
+                coefficients.push_back(it.value());
+                values.push_back(point(j) - lower(j));
+                rhs -= it.value() * lower(j);
+            } else {
+                complemented.push_back(true);
+                coefficients.push_back(-it.value());
+                values.push_back(upper(j) - point(j));
+                rhs -= it.value() * upper(j);
+            }
+            if(integers.back() && values.back() > SEPARATION_TOLERANCE && (long long) divisors.size() < MIR_DIVISORS
+                    && find(divisors.begin(), divisors.end(), fabs(coefficients.back())) == divisors.end()) {
+                divisors.push_back(fabs(coefficients.back()));
+            }
+        }
+
+        //variável livre não pode ser escrita como x' >= 0
+        if(free) {
+            continue;
+        }
+
+        bestViolation = SEPARATION_TOLERANCE;
+        bestDivisor = 0;
+        for(size_t d = 0; d < divisors.size(); d++) {
+            divided = rhs / divisors[d];
+            fraction = divided - floor(divided);
+            if(fraction < MIR_MIN_FRACTION || fraction > 1 - MIR_MIN_FRACTION) {
+                continue;
+            }
+            violation = -floor(divided);
+            norm = 0;
+            for(size_t k = 0; k < variables.size(); k++) {
+                coefficient = coefficients[k] / divisors[d];
+                coefficientFraction = coefficient - floor(coefficient);
+                if(integers[k]) {
+                    coefficient = floor(coefficient) + fmax(0, coefficientFraction - fraction) / (1 - fraction);
+                } else {
+                    coefficient = fmin(0, coefficient) / (1 - fraction);
+                }
+                violation += coefficient * values[k];
+                norm += coefficient * coefficient;
+            }
+            if(norm > 0 && violation / sqrt(norm) > bestViolation) {
+                bestViolation = violation / sqrt(norm);
+                bestDivisor = divisors[d];
+            }
+        }
+        if(bestDivisor == 0) {
+            continue;
+        }
+
+        //volta para as variáveis originais
+        divided = rhs / bestDivisor;
+        fraction = divided - floor(divided);
+        cut = VectorXd::Zero(this->numberOfVariables);
+        cutRhs = floor(divided);
+        for(size_t k = 0; k < variables.size(); k++) {
+            coefficient = coefficients[k] / bestDivisor;
+            coefficientFraction = coefficient - floor(coefficient);
+            if(integers[k]) {
+                coefficient = floor(coefficient) + fmax(0, coefficientFraction - fraction) / (1 - fraction);
+            } else {
+                coefficient = fmin(0, coefficient) / (1 - fraction);
+            }
+            j = variables[k];
+            if(complemented[k]) {
+                cut(j) -= coefficient;
+                cutRhs -= coefficient * upper(j);
+            } else {
+                cut(j) += coefficient;
+                cutRhs += coefficient * lower(j);
+            }
+        }
+        cuts.push_back(this->makeCut(cut, cutRhs));
+    }
+}
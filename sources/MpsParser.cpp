@@ -0,0 +1,580 @@
+#include "../headers/MpsParser.h"
+#include "../headers/Parser.h"
+#include "../headers/Exception.h"
+#include <cctype>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: interpreta todo o conteúdo em uma passada
+ *
+ * @param const char *begin início do conteúdo do arquivo
+ * @param const char *end fim do conteúdo (não precisa terminar em '\0')
+ * @param int format MPS_FREE ou MPS_FIXED
+ */
+MpsParser::MpsParser(const char *begin, const char *end, int format) {
+    this->current = begin;
+    this->end = end;
+    this->format = format;
+    //o MPS minimiza, a menos que OBJSENSE diga o contrário
+    this->mode = 1;
+    this->line = 0;
+    this->section = MPS_NO_SECTION;
+    this->header = false;
+    this->hasObjective = false;
+    this->objectiveOffset = 0;
+    this->integerMarker = false;
+    this->hasIntegrality = false;
+
+    while(this->readLine()) {
+        if(this->header) {
+            if(this->getField(0) == "ENDATA") {
+                return;
+            }
+            this->readHeader();
+            continue;
+        }
+        switch(this->section) {
+            case MPS_ROWS:
+                this->readRow();
+                break;
+            case MPS_COLUMNS:
+                this->readColumn();
+                break;
+            case MPS_RHS:
+                this->readRightHandSide(false);
+                break;
+            case MPS_RANGES:
+                this->readRightHandSide(true);
+                break;
+            case MPS_BOUNDS:
+                this->readBound();
+                break;
+            case MPS_OBJSENSE:
+                this->readSense(this->getField(0));
+                break;
+            default:
+                this->error("dados fora de uma secao");
+        }
+    }
+}
+
+/**
+ * @desc Avança para a próxima linha com conteúdo (pula linhas vazias e comentários '*') e
+ * @desc separa os seus campos
+ *
+ * @returns bool false no fim do conteúdo
+ */
+bool MpsParser::readLine() {
+    const char *lineStart, *lineEnd;
+
+    while(this->current != this->end) {
+        lineStart = this->current;
+        lineEnd = (const char*) memchr(lineStart, '\n', this->end - lineStart);
+        if(lineEnd == NULL) {
+            lineEnd = this->end;
+            this->current = this->end;
+        } else {
+            this->current = lineEnd + 1;
+        }
+        this->line++;
+        if(lineEnd != lineStart && *(lineEnd - 1) == '\r') {
+            lineEnd--;
+        }
+        if(lineStart == lineEnd || *lineStart == '*') {
+            continue;
+        }
+
+        //seções começam na primeira coluna e sempre têm os campos separados por espaços
+        this->header = (*lineStart != ' ' && *lineStart != '\t');
+        if(this->header || this->format == MPS_FREE) {
+            this->splitFree(lineStart, lineEnd);
+        } else {
+            this->splitFixed(lineStart, lineEnd);
+        }
+        if(!this->fields.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @desc Separa os campos da linha por espaços (formato livre)
+ *
+ * @param const char *lineStart
+ * @param const char *lineEnd
+ * @returns void
+ */
+void MpsParser::splitFree(const char *lineStart, const char *lineEnd) {
+    const char *first;
+
+    this->fields.clear();
+    while(lineStart != lineEnd) {
+        while(lineStart != lineEnd && (*lineStart == ' ' || *lineStart == '\t')) {
+            lineStart++;
+        }
+        first = lineStart;
+        while(lineStart != lineEnd && *lineStart != ' ' && *lineStart != '\t') {
+            lineStart++;
+        }
+        if(first != lineStart) {
+            this->fields.push_back(make_pair(first, lineStart));
+        }
+    }
+}
+
+/**
+ * @desc Separa os campos da linha pelas colunas do formato fixo (campos vazios são descartados)
+ *
+ * @param const char *lineStart
+ * @param const char *lineEnd
+ * @returns void
+ */
+void MpsParser::splitFixed(const char *lineStart, const char *lineEnd) {
+    static const long long starts[] = {1, 4, 14, 24, 39, 49};
+    static const long long ends[] = {3, 12, 22, 36, 47, 61};
+    const char *first, *last;
+
+    this->fields.clear();
+    for(int k = 0; k < 6; k++) {
+        if(lineEnd - lineStart <= starts[k]) {
+            break;
+        }
+        first = lineStart + starts[k];
+        //o último campo vai até o fim da linha
+        last = (k == 5 || lineEnd - lineStart < ends[k]) ? lineEnd : lineStart + ends[k];
+        while(first != last && (*first == ' ' || *first == '\t')) {
+            first++;
+        }
+        while(last != first && (*(last - 1) == ' ' || *(last - 1) == '\t')) {
+            last--;
+        }
+        if(first != last) {
+            this->fields.push_back(make_pair(first, last));
+        }
+    }
+}
+
+/**
+ * @desc Interpreta a linha de início de uma seção
+ *
+ * @returns void
+ */
+void MpsParser::readHeader() {
+    string name = this->getField(0);
+
+    if(name == "NAME") {
+        this->section = MPS_NO_SECTION;
+    } else if(name == "ROWS") {
+        this->section = MPS_ROWS;
+    } else if(name == "COLUMNS") {
+        this->section = MPS_COLUMNS;
+    } else if(name == "RHS") {
+        this->section = MPS_RHS;
+    } else if(name == "RANGES") {
+        this->section = MPS_RANGES;
+    } else if(name == "BOUNDS") {
+        this->section = MPS_BOUNDS;
+    } else if(name == "OBJSENSE") {
+        this->section = MPS_OBJSENSE;
+        //formato livre: "OBJSENSE MAX" na mesma linha
+        if(this->fields.size() > 1) {
+            this->readSense(this->getField(1));
+        }
+    } else {
+        this->error("secao nao suportada " + name);
+    }
+}
+
+/**
+ * @desc Lê uma linha da seção ROWS: "tipo nome"
+ *
+ * @returns void
+ */
+void MpsParser::readRow() {
+    string type, name;
+
+    if(this->fields.size() != 2) {
+        this->error("ROWS espera tipo e nome");
+    }
+    type = this->getField(0);
+    name = this->getField(1);
+    if(this->rowNames.intern(this->fields[1].first, this->fields[1].second) < (long long) this->rowIndices.size()) {
+        this->error("linha repetida " + name);
+    }
+
+    if(type == "N" || type == "n") {
+        //a primeira linha N é o objetivo, as outras são ignoradas
+        this->rowIndices.push_back(this->hasObjective ? MPS_FREE_ROW : MPS_OBJECTIVE_ROW);
+        this->hasObjective = true;
+        return;
+    }
+
+    this->rowIndices.push_back(this->relations.size());
+    if(type == "L" || type == "l") {
+        this->relations.push_back(0);
+    } else if(type == "G" || type == "g") {
+        this->relations.push_back(1);
+    } else if(type == "E" || type == "e") {
+        this->relations.push_back(2);
+    } else {
+        this->error("tipo de linha " + type);
+    }
+    this->rightHandSides.push_back(0);
+    this->ranges.push_back(numeric_limits<double>::quiet_NaN());
+}
+
+/**
+ * @desc Lê uma linha da seção COLUMNS: "coluna linha valor [linha valor]" ou um MARKER
+ *
+ * @returns void
+ */
+void MpsParser::readColumn() {
+    long long row, column;
+    double value;
+
+    if(this->fields.size() >= 3 && this->getField(1) == "'MARKER'") {
+        if(this->getField(2) == "'INTORG'") {
+            this->integerMarker = true;
+        } else if(this->getField(2) == "'INTEND'" && this->integerMarker) {
+            this->integerMarker = false;
+        } else {
+            this->error("MARKER invalido");
+        }
+        this->hasIntegrality = true;
+        return;
+    }
+    if(this->fields.size() != 3 && this->fields.size() != 5) {
+        this->error("COLUMNS espera coluna, linha e valor");
+    }
+
+    column = this->columns.intern(this->fields[0].first, this->fields[0].second);
+    if(column == (long long) this->lowerBounds.size()) {
+        this->lowerBounds.push_back(0);
+        this->upperBounds.push_back(numeric_limits<double>::infinity());
+        this->lowerDefined.push_back(false);
+        this->variableTypes.push_back(CONTINUOUS_VARIABLE);
+    }
+    if(this->integerMarker && this->variableTypes[column] == CONTINUOUS_VARIABLE) {
+        this->variableTypes[column] = GENERAL_VARIABLE;
+    }
+
+    for(size_t k = 1; k < this->fields.size(); k += 2) {
+        row = this->findRow(k);
+        value = this->readValue(k + 1);
+        if(row == MPS_OBJECTIVE_ROW) {
+            this->objective.push_back(make_pair(column, value));
+        } else if(row != MPS_FREE_ROW && value != 0) {
+            this->coefficients.push_back(Triplet<double>(row, column, value));
+        }
+    }
+}
+
+/**
+ * @desc Lê uma linha das seções RHS ou RANGES: "[conjunto] linha valor [linha valor]". O lado
+ * @desc direito do objetivo é o oposto de uma constante somada ao valor da função objetivo.
+ *
+ * @param bool range true para a seção RANGES
+ * @returns void
+ */
+void MpsParser::readRightHandSide(bool range) {
+    //com um número ímpar de campos o primeiro é o nome do conjunto
+    size_t first = this->fields.size() % 2;
+    long long row;
+    double value;
+
+    if(this->fields.size() < 2 || this->fields.size() > 5) {
+        this->error("RHS/RANGES espera linha e valor");
+    }
+    for(size_t k = first; k < this->fields.size(); k += 2) {
+        row = this->findRow(k);
+        value = this->readValue(k + 1);
+        if(row == MPS_OBJECTIVE_ROW && !range) {
+            this->objectiveOffset = -value;
+        } else if(row >= 0 && range) {
+            this->ranges[row] = value;
+        } else if(row >= 0) {
+            this->rightHandSides[row] = value;
+        }
+    }
+}
+
+/**
+ * @desc Lê uma linha da seção BOUNDS: "tipo [conjunto] coluna [valor]"
+ *
+ * @returns void
+ */
+void MpsParser::readBound() {
+    double infinity = numeric_limits<double>::infinity();
+    string type = this->getField(0);
+    bool needsValue;
+    long long column, field;
+    double value = 0;
+
+    //o tipo é aceito em qualquer caixa, como nas linhas de ROWS
+    for(size_t k = 0; k < type.size(); k++) {
+        type[k] = toupper((unsigned char) type[k]);
+    }
+    needsValue = (type == "UP" || type == "LO" || type == "FX" || type == "LI" || type == "UI");
+
+    if(needsValue) {
+        if(this->fields.size() != 3 && this->fields.size() != 4) {
+            this->error("BOUNDS espera tipo, coluna e valor");
+        }
+        field = this->fields.size() - 2;
+        value = this->readValue(field + 1);
+    } else {
+        if(this->fields.size() < 2 || this->fields.size() > 4) {
+            this->error("BOUNDS espera tipo e coluna");
+        }
+        //BV pode trazer o valor 1: "BV coluna 1" ou "BV conjunto coluna [1]"
+        field = (this->fields.size() == 2 || (this->fields.size() == 3 && this->columns.find(this->fields[2].first, this->fields[2].second) == -1)) ? 1 : 2;
+    }
+    column = this->findColumn(field);
+
+    //BV, LI e UI também declaram a coluna inteira
+    if(type == "BV") {
+        this->variableTypes[column] = BINARY_VARIABLE;
+        this->hasIntegrality = true;
+    } else if((type == "LI" || type == "UI") && this->variableTypes[column] == CONTINUOUS_VARIABLE) {
+        this->variableTypes[column] = GENERAL_VARIABLE;
+        this->hasIntegrality = true;
+    }
+
+    if(type == "UP" || type == "UI") {
+        //convenção do MPS: limite superior negativo sem limite inferior torna a coluna livre por baixo
+        if(value < 0 && !this->lowerDefined[column] && this->lowerBounds[column] == 0) {
+            this->lowerBounds[column] = -infinity;
+        }
+        this->upperBounds[column] = value;
+    } else if(type == "LO" || type == "LI") {
+        this->lowerBounds[column] = value;
+        this->lowerDefined[column] = true;
+    } else if(type == "FX") {
+        this->lowerBounds[column] = value;
+        this->upperBounds[column] = value;
+        this->lowerDefined[column] = true;
+    } else if(type == "FR") {
+        this->lowerBounds[column] = -infinity;
+        this->upperBounds[column] = infinity;
+        this->lowerDefined[column] = true;
+    } else if(type == "MI") {
+        this->lowerBounds[column] = -infinity;
+        this->lowerDefined[column] = true;
+    } else if(type == "PL") {
+        this->upperBounds[column] = infinity;
+    } else if(type == "BV") {
+        this->lowerBounds[column] = 0;
+        this->upperBounds[column] = 1;
+        this->lowerDefined[column] = true;
+    } else {
+        this->error("tipo de limite " + type);
+    }
+}
+
+/**
+ * @desc Lê o sentido da otimização da seção OBJSENSE
+ *
+ * @param const string &sense MAX, MAXIMIZE, MIN ou MINIMIZE
+ * @returns void
+ */
+void MpsParser::readSense(const string &sense) {
+    if(sense == "MAX" || sense == "MAXIMIZE") {
+        this->mode = 2;
+    } else if(sense == "MIN" || sense == "MINIMIZE") {
+        this->mode = 1;
+    } else {
+        this->error("OBJSENSE " + sense);
+    }
+}
+
+/**
+ * @desc Busca a linha pelo nome do campo
+ *
+ * @param long long field índice do campo
+ * @returns long long índice da restrição, MPS_OBJECTIVE_ROW ou MPS_FREE_ROW
+ */
+long long MpsParser::findRow(long long field) {
+    long long id = this->rowNames.find(this->fields[field].first, this->fields[field].second);
+
+    if(id == -1) {
+        this->error("linha desconhecida " + this->getField(field));
+    }
+    return this->rowIndices[id];
+}
+
+/**
+ * @desc Busca a coluna pelo nome do campo
+ *
+ * @param long long field índice do campo
+ * @returns long long índice da coluna
+ */
+long long MpsParser::findColumn(long long field) {
+    long long id = this->columns.find(this->fields[field].first, this->fields[field].second);
+
+    if(id == -1) {
+        this->error("coluna desconhecida " + this->getField(field));
+    }
+    return id;
+}
+
+/**
+ * @desc Lê o valor numérico de um campo (valores a partir de MPS_INFINITY, "inf" e "infinity" são infinitos)
+ *
+ * @param long long field índice do campo
+ * @returns double
+ */
+double MpsParser::readValue(long long field) {
+    const char *position = this->fields[field].first, *last = this->fields[field].second;
+    double sign = 1, value;
+    string text;
+
+    if(position != last && (*position == '+' || *position == '-')) {
+        sign = (*position == '-') ? -1 : 1;
+        position++;
+    }
+    if(!Parser::readNumber(position, last, value) || position != last) {
+        text = string(position, last);
+        for(size_t k = 0; k < text.size(); k++) {
+            text[k] = tolower(text[k]);
+        }
+        if(text != "inf" && text != "infinity") {
+            this->error("valor invalido " + this->getField(field));
+        }
+        value = numeric_limits<double>::infinity();
+    }
+    if(value >= MPS_INFINITY) {
+        value = numeric_limits<double>::infinity();
+    }
+    return sign * value;
+}
+
+/**
+ * @desc Retorna o texto de um campo da linha atual
+ *
+ * @param long long field índice do campo
+ * @returns string
+ */
+string MpsParser::getField(long long field) {
+    return string(this->fields[field].first, this->fields[field].second);
+}
+
+/**
+ * @desc Interrompe a leitura com o número da linha atual
+ *
+ * @param const string &detail
+ * @returns void
+ */
+void MpsParser::error(const string &detail) {
+    throw(new Exception("MpsParser: Erro na linha " + to_string(this->line) + " (" + detail + ")!"));
+}
+
+/**
+ * @desc Monta o problema lido. As triplas chegam por coluna, então são agrupadas por linha com uma
+ * @desc ordenação por contagem; cada linha com RANGES ganha uma cópia no fim com a outra relação.
+ *
+ * @returns Problem*
+ */
+Problem* MpsParser::getProblem() {
+    long long n = this->columns.size(), m = this->relations.size(), row;
+    VectorXd objectiveFunction = VectorXd::Zero(n);
+    vector<size_t> positions(m + 1, 0);
+    vector<Triplet<double> > grouped(this->coefficients.size());
+    vector<int> relations = this->relations;
+    vector<double> rightHandSides = this->rightHandSides;
+    VectorXd relationsVector;
+    vector<string> names(n);
+    double range;
+    Problem *problem;
+
+    if(n == 0) {
+        throw(new Exception("MpsParser: Nenhuma variavel encontrada!"));
+    }
+
+    for(size_t k = 0; k < this->objective.size(); k++) {
+        objectiveFunction(this->objective[k].first) += this->objective[k].second;
+    }
+
+    for(size_t k = 0; k < this->coefficients.size(); k++) {
+        positions[this->coefficients[k].row() + 1]++;
+    }
+    for(long long i = 0; i < m; i++) {
+        positions[i + 1] += positions[i];
+    }
+    for(size_t k = 0; k < this->coefficients.size(); k++) {
+        grouped[positions[this->coefficients[k].row()]++] = this->coefficients[k];
+    }
+
+    //intervalos: L [rhs - |R|, rhs], G [rhs, rhs + |R|], E [rhs, rhs + R] se R > 0 ou [rhs + R, rhs] se R < 0
+    for(long long i = 0; i < m; i++) {
+        range = this->ranges[i];
+        if(std::isnan(range) || (relations[i] == 2 && range == 0)) {
+            continue;
+        }
+        if(relations[i] == 2) {
+            relations[i] = (range > 0) ? 1 : 0;
+        }
+        row = relations.size();
+        relations.push_back(1 - relations[i]);
+        rightHandSides.push_back(rightHandSides[i] + ((relations[i] == 0) ? -fabs(range) : fabs(range)));
+        //as entradas da linha i ocupam [positions[i-1], positions[i]) depois da distribuição
+        for(size_t k = (i == 0) ? 0 : positions[i - 1]; k < positions[i]; k++) {
+            grouped.push_back(Triplet<double>(row, grouped[k].col(), grouped[k].value()));
+        }
+    }
+
+    relationsVector.resize(relations.size());
+    for(size_t i = 0; i < relations.size(); i++) {
+        relationsVector(i) = relations[i];
+    }
+    problem = new Problem(objectiveFunction, Parser::buildConstraints(grouped, rightHandSides, n), relationsVector);
+    for(long long j = 0; j < n; j++) {
+        problem->setBounds(j, this->lowerBounds[j], this->upperBounds[j]);
+        names[j] = this->columns.getName(j);
+        if(this->hasIntegrality) {
+            problem->setVariableType(j, this->variableTypes[j]);
+        }
+    }
+    problem->setVariableNames(names);
+    return problem;
+}
+
+/**
+ * @desc Retorna o modo lido (1 minimização, 2 maximização)
+ *
+ * @returns int
+ */
+int MpsParser::getMode() {
+    return this->mode;
+}
+
+/**
+ * @desc Retorna o número de linhas lidas
+ *
+ * @returns long long
+ */
+long long MpsParser::getLines() {
+    return this->line;
+}
+
+/**
+ * @desc Retorna o número de coeficientes não nulos das restrições (sem as cópias das linhas com RANGES)
+ *
+ * @returns long long
+ */
+long long MpsParser::getNonzeros() {
+    return this->coefficients.size();
+}
+
+/**
+ * @desc Retorna a constante da função objetivo (oposto do RHS da linha do objetivo)
+ *
+ * @returns double
+ */
+double MpsParser::getObjectiveOffset() {
+    return this->objectiveOffset;
+}
@@ -0,0 +1,142 @@
+#include "../headers/MpsWriter.h"
+#include "../headers/Exception.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+
+/**
+ * @desc Construtor
+ *
+ * @param Problem *problem problema a ser escrito
+ * @param int mode 1 minimiza, 2 maximiza
+ * @param double objectiveOffset constante da função objetivo
+ */
+MpsWriter::MpsWriter(Problem *problem, int mode, double objectiveOffset) {
+    this->problem = problem;
+    this->mode = mode;
+    this->objectiveOffset = objectiveOffset;
+}
+
+/**
+ * @desc Escreve o problema no arquivo, no formato MPS livre. As variáveis mantêm os nomes do
+ * @desc problema (ou x1..xn) e as restrições se chamam R1..Rm; as colunas inteiras ficam entre os
+ * @desc marcadores INTORG/INTEND e as binárias com limites [0, 1] viram BV. Sempre há ao menos um
+ * @desc par de marcadores, para que um problema só com contínuas não seja relido como inteiro.
+ *
+ * @param const string fileName
+ * @returns void
+ */
+void MpsWriter::write(const string fileName) {
+    ofstream file(fileName.c_str());
+    const SparseMatrixXd &constraints = this->problem->getConstraints();
+    VectorXd objectiveFunction = this->problem->getObjectiveFunction();
+    VectorXd relations = this->problem->getRelations();
+    VectorXd lowerBounds = this->problem->getLowerBounds();
+    VectorXd upperBounds = this->problem->getUpperBounds();
+    long long m = constraints.rows();
+    long long n = objectiveFunction.size();
+    const char *types[] = {"L", "G", "E"};
+    vector<string> names(n);
+    double rhs;
+
+    if(!file.is_open()) {
+        throw(new Exception("MpsWriter: Nao foi possivel criar o arquivo " + fileName + "!"));
+    }
+
+    //a transposta dá as colunas em ordem, como o COLUMNS pede
+    SparseMatrix<double, RowMajor> columns = constraints.leftCols(n).transpose();
+
+    for(long long j = 0; j < n; j++) {
+        names[j] = this->problem->getVariableName(j);
+    }
+
+    file << "NAME ILP" << endl;
+    if(this->mode == 2) {
+        file << "OBJSENSE" << endl << "    MAX" << endl;
+    }
+
+    file << "ROWS" << endl << " N OBJ" << endl;
+    for(long long i = 0; i < m; i++) {
+        file << " " << types[(int) relations(i)] << " R" << i + 1 << endl;
+    }
+
+    file << "COLUMNS" << endl;
+    if(n == 0 || !this->problem->isInteger(0)) {
+        file << "    MARKER 'MARKER' 'INTORG'" << endl;
+        file << "    MARKER 'MARKER' 'INTEND'" << endl;
+    }
+    for(long long j = 0; j < n; j++) {
+        if(this->problem->isInteger(j) && (j == 0 || !this->problem->isInteger(j-1))) {
+            file << "    MARKER 'MARKER' 'INTORG'" << endl;
+        }
+        //coluna sem coeficientes ainda precisa aparecer para existir
+        if(objectiveFunction(j) != 0 || columns.outerIndexPtr()[j] == columns.outerIndexPtr()[j+1]) {
+            file << "    " << names[j] << " OBJ " << this->formatNumber(objectiveFunction(j)) << endl;
+        }
+        for(SparseMatrix<double, RowMajor>::InnerIterator it(columns, j); it; ++it) {
+            file << "    " << names[j] << " R" << it.col() + 1 << " " << this->formatNumber(it.value()) << endl;
+        }
+        if(this->problem->isInteger(j) && (j == n-1 || !this->problem->isInteger(j+1))) {
+            file << "    MARKER 'MARKER' 'INTEND'" << endl;
+        }
+    }
+
+    file << "RHS" << endl;
+    if(this->objectiveOffset != 0) {
+        //no MPS o RHS do objetivo entra com o sinal trocado
+        file << "    RHS OBJ " << this->formatNumber(-this->objectiveOffset) << endl;
+    }
+    for(long long i = 0; i < m; i++) {
+        rhs = constraints.coeff(i, n);
+        if(rhs != 0) {
+            file << "    RHS R" << i + 1 << " " << this->formatNumber(rhs) << endl;
+        }
+    }
+
+    file << "BOUNDS" << endl;
+    for(long long j = 0; j < n; j++) {
+        if(this->problem->getVariableType(j) == BINARY_VARIABLE && lowerBounds(j) == 0 && upperBounds(j) == 1) {
+            file << " BV BND " << names[j] << endl;
+            continue;
+        }
+        if(lowerBounds(j) == upperBounds(j)) {
+            file << " FX BND " << names[j] << " " << this->formatNumber(lowerBounds(j)) << endl;
+            continue;
+        }
+        if(std::isinf(lowerBounds(j)) && std::isinf(upperBounds(j))) {
+            file << " FR BND " << names[j] << endl;
+            continue;
+        }
+        if(std::isinf(lowerBounds(j))) {
+            file << " MI BND " << names[j] << endl;
+        } else if(lowerBounds(j) != 0 || upperBounds(j) < 0) {
+            //UP negativo sem LO tornaria o limite inferior -inf
+            file << " LO BND " << names[j] << " " << this->formatNumber(lowerBounds(j)) << endl;
+        }
+        if(!std::isinf(upperBounds(j))) {
+            file << " UP BND " << names[j] << " " << this->formatNumber(upperBounds(j)) << endl;
+        }
+    }
+
+    file << "ENDATA" << endl;
+
+    if(!file.good()) {
+        throw(new Exception("MpsWriter: Erro ao escrever o arquivo " + fileName + "!"));
+    }
+}
+
+/**
+ * @desc Formata o número com 15 dígitos ou, se não voltar ao mesmo valor, com 17
+ *
+ * @param double value
+ * @returns string
+ */
+string MpsWriter::formatNumber(double value) {
+    char buffer[32];
+
+    snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if(strtod(buffer, NULL) != value) {
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+    return buffer;
+}
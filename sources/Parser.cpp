@@ -0,0 +1,1118 @@
+#include "../headers/Parser.h"
+#include "../headers/Exception.h"
+#include <cctype>
+#include <cstdlib>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+using namespace Eigen;
+
+//potências de 10 representadas exatamente em double
+static const double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+ * @desc Construtor: interpreta todo o conteúdo em uma passada
+ *
+ * @param const char *begin início do conteúdo do arquivo
+ * @param const char *end fim do conteúdo (não precisa terminar em '\0')
+ * @param int format FREE_FORMAT ou LP_FORMAT
+ * @param int numberOfThreads threads para as restrições e a montagem da matriz
+ */
+Parser::Parser(const char *begin, const char *end, int format, int numberOfThreads) {
+    this->current = begin;
+    this->end = end;
+    this->format = format;
+    this->numberOfThreads = max(numberOfThreads, 1);
+    this->numberOfChunks = 1;
+    this->failed = false;
+    this->mode = 0;
+    this->line = 1;
+    this->hasIntegrality = false;
+    //reserva as triplas pelo tamanho do conteúdo, para o vetor não ser realocado durante a leitura
+    //(em paralelo cada bloco reserva as suas)
+    if(this->numberOfThreads == 1 || end - begin < 2 * PARSER_MIN_CHUNK_BYTES) {
+        this->coefficients.reserve((end - begin) / PARSER_BYTES_PER_COEFFICIENT);
+    }
+
+    if(format == FREE_FORMAT) {
+        this->parseFreeFormat();
+    } else {
+        this->parseLPFormat();
+    }
+}
+
+/**
+ * @desc Construtor de um bloco de restrições, interpretado depois por parseChunk
+ *
+ * @param int format FREE_FORMAT ou LP_FORMAT
+ */
+Parser::Parser(int format) {
+    this->current = NULL;
+    this->end = NULL;
+    this->format = format;
+    this->numberOfThreads = 1;
+    this->numberOfChunks = 1;
+    this->failed = false;
+    this->mode = 0;
+    this->line = 1;
+    this->hasIntegrality = false;
+}
+
+/**
+ * @desc Formato livre: a primeira linha tem o modo e a função objetivo ("Max Z = 5x1 + 9x2"),
+ * @desc as seguintes uma restrição cada
+ *
+ * @returns void
+ */
+void Parser::parseFreeFormat() {
+    const char *position;
+
+    this->skipBlank(true);
+    if(this->end - this->current >= 3 && toupper(this->current[0]) == 'M' && toupper(this->current[1]) == 'A'
+        && toupper(this->current[2]) == 'X') {
+        this->mode = 2;
+    } else if(this->end - this->current >= 3 && toupper(this->current[0]) == 'M' && toupper(this->current[1]) == 'I'
+        && toupper(this->current[2]) == 'N') {
+        this->mode = 1;
+    } else {
+        throw(new Exception("Parser: Nao encontrado modo (Maximizar ou Minimizar) da funcao objetivo!"));
+    }
+
+    //o nome da função objetivo ("Z") vai até o '='
+    while(this->current != this->end && *this->current != '=' && *this->current != '\n') {
+        this->current++;
+    }
+    if(this->current == this->end || *this->current != '=') {
+        this->error();
+    }
+    this->current++;
+    this->readExpression(-1, true);
+    this->expectLineEnd();
+
+    if(this->parseConstraintsInParallel(true)) {
+        return;
+    }
+    while(true) {
+        this->skipBlank(true);
+        if(this->current == this->end) {
+            break;
+        }
+        position = this->current;
+        this->parseConstraint(true);
+        if(this->current == position) {
+            this->error();
+        }
+    }
+}
+
+/**
+ * @desc Formato lp: modo, função objetivo, Subject To, Bounds, Generals, Binaries e End. As seções são
+ * @desc reconhecidas no início das linhas; Generals e Binaries listam as variáveis inteiras e End encerra a leitura.
+ *
+ * @returns void
+ */
+void Parser::parseLPFormat() {
+    int section = OBJECTIVE_SECTION, found;
+    const char *position;
+
+    this->skipBlank(true);
+    if(this->readKeyword("maximize") || this->readKeyword("maximum") || this->readKeyword("max")) {
+        this->mode = 2;
+    } else if(this->readKeyword("minimize") || this->readKeyword("minimum") || this->readKeyword("min")) {
+        this->mode = 1;
+    } else {
+        throw(new Exception("Parser: Nao encontrado modo (Maximizar ou Minimizar) da funcao objetivo!"));
+    }
+
+    while(true) {
+        this->skipBlank(true);
+        if(this->current == this->end) {
+            break;
+        }
+        found = this->readSection();
+        if(found == END_SECTION) {
+            break;
+        } else if(found != 0) {
+            section = found;
+            if(section == CONSTRAINTS_SECTION) {
+                this->parseConstraintsInParallel(false);
+            }
+            continue;
+        }
+
+        position = this->current;
+        if(section == OBJECTIVE_SECTION) {
+            this->readLabel();
+            this->readExpression(-1, false);
+        } else if(section == CONSTRAINTS_SECTION) {
+            this->parseConstraint(false);
+        } else if(section == BOUNDS_SECTION) {
+            this->parseBound();
+        } else {
+            this->parseVariableType((section == BINARIES_SECTION) ? BINARY_VARIABLE : GENERAL_VARIABLE);
+        }
+        if(this->current == position) {
+            this->error();
+        }
+    }
+}
+
+/**
+ * @desc Lê uma restrição "[nome:] expressão relação valor"
+ *
+ * @param bool lineBased true se a restrição ocupa exatamente uma linha (formato livre)
+ * @returns void
+ */
+void Parser::parseConstraint(bool lineBased) {
+    long long row = this->relations.size();
+
+    if(!lineBased) {
+        this->readLabel();
+    }
+    this->readExpression(row, lineBased);
+    this->relations.push_back(this->readRelation(lineBased));
+    this->rightHandSides.push_back(this->readValue(lineBased));
+    if(lineBased) {
+        this->expectLineEnd();
+    }
+}
+
+/**
+ * @desc Interpreta em paralelo as restrições a partir da posição atual até o fim da seção: o trecho
+ * @desc é dividido em um bloco por thread, cada bloco termina no fim de uma restrição e é lido por um
+ * @desc Parser próprio; as linhas dos blocos são juntadas em ordem. Trechos pequenos ficam com a
+ * @desc leitura sequencial.
+ *
+ * @param bool lineBased true se cada restrição ocupa exatamente uma linha (formato livre)
+ * @returns bool false se nada foi lido (uma thread ou trecho pequeno)
+ */
+bool Parser::parseConstraintsInParallel(bool lineBased) {
+    const char *regionEnd, *position;
+    vector<const char*> bounds;
+    vector<Parser*> chunks;
+    vector<thread> threads;
+    vector<long long> blocks;
+    vector<size_t> offsets;
+    vector<vector<long long> > symbolMaps;
+    string name;
+    long long count, rowOffset = this->relations.size(), errorLine = -1;
+
+    if(this->numberOfThreads == 1 || this->end - this->current < 2 * PARSER_MIN_CHUNK_BYTES) {
+        return false;
+    }
+    regionEnd = lineBased ? this->end : this->findConstraintsEnd();
+    count = min((long long) this->numberOfThreads, (long long) (regionEnd - this->current) / PARSER_MIN_CHUNK_BYTES);
+    if(count < 2) {
+        return false;
+    }
+
+    bounds.push_back(this->current);
+    for(long long k = 1; k < count; k++) {
+        position = max(bounds.back(), this->current + (regionEnd - this->current) * k / count);
+        bounds.push_back(this->findChunkEnd(position, regionEnd, lineBased));
+    }
+    bounds.push_back(regionEnd);
+
+    for(long long k = 0; k < count; k++) {
+        chunks.push_back(new Parser(this->format));
+        threads.push_back(thread(&Parser::parseChunk, chunks[k], bounds[k], bounds[k+1], lineBased));
+    }
+    for(long long k = 0; k < count; k++) {
+        threads[k].join();
+    }
+    threads.clear();
+
+    //o erro que vale é o do primeiro bloco, com a linha contada desde o início do arquivo
+    offsets.push_back(this->coefficients.size());
+    for(long long k = 0; k < count; k++) {
+        if(chunks[k]->failed && errorLine == -1) {
+            errorLine = this->line + chunks[k]->line - 1;
+        }
+        this->line += chunks[k]->line - 1;
+        offsets.push_back(offsets.back() + chunks[k]->coefficients.size());
+    }
+    if(errorLine != -1) {
+        for(long long k = 0; k < count; k++) {
+            delete chunks[k];
+        }
+        this->line = errorLine;
+        this->error();
+    }
+
+    //os nomes de cada bloco entram na tabela principal na ordem dos blocos, então as colunas
+    //ficam na mesma ordem da leitura sequencial
+    symbolMaps.resize(count);
+    for(long long k = 0; k < count; k++) {
+        for(long long id = 0; id < chunks[k]->symbols.size(); id++) {
+            name = chunks[k]->symbols.getName(id);
+            symbolMaps[k].push_back(this->symbols.intern(name.data(), name.data() + name.size()));
+        }
+    }
+
+    //as triplas de cada bloco são copiadas em paralelo, com as linhas deslocadas e as colunas traduzidas
+    this->coefficients.resize(offsets.back());
+    for(long long k = 0; k < count; k++) {
+        blocks.push_back(k);
+    }
+    blocks.push_back(count);
+    //cada bloco é um único pedaço: só o início importa
+    Parser::runBlocks(blocks, [&](long long first, long long) {
+        long long rows = rowOffset;
+        for(long long k = 0; k < first; k++) {
+            rows += chunks[k]->relations.size();
+        }
+        for(size_t j = 0; j < chunks[first]->coefficients.size(); j++) {
+            const Triplet<double> &coefficient = chunks[first]->coefficients[j];
+            this->coefficients[offsets[first] + j] = Triplet<double>(rows + coefficient.row(),
+                symbolMaps[first][coefficient.col()], coefficient.value());
+        }
+    });
+
+    for(long long k = 0; k < count; k++) {
+        this->relations.insert(this->relations.end(), chunks[k]->relations.begin(), chunks[k]->relations.end());
+        this->rightHandSides.insert(this->rightHandSides.end(), chunks[k]->rightHandSides.begin(),
+            chunks[k]->rightHandSides.end());
+        delete chunks[k];
+    }
+    this->numberOfChunks = count;
+    this->current = regionEnd;
+    return true;
+}
+
+/**
+ * @desc Lê as restrições de um bloco (executado na thread do bloco). Um erro não é propagado:
+ * @desc fica marcado, com a linha relativa ao início do bloco, para o Parser principal
+ *
+ * @param const char *begin início do bloco
+ * @param const char *end fim do bloco
+ * @param bool lineBased true se cada restrição ocupa exatamente uma linha (formato livre)
+ * @returns void
+ */
+void Parser::parseChunk(const char *begin, const char *end, bool lineBased) {
+    const char *position;
+
+    this->current = begin;
+    this->end = end;
+    this->coefficients.reserve((end - begin) / PARSER_BYTES_PER_COEFFICIENT);
+    try {
+        while(true) {
+            this->skipBlank(true);
+            if(this->current == this->end) {
+                break;
+            }
+            position = this->current;
+            this->parseConstraint(lineBased);
+            if(this->current == position) {
+                this->error();
+            }
+        }
+    } catch(Exception *ex) {
+        delete ex;
+        this->failed = true;
+    }
+}
+
+/**
+ * @desc Procura o fim da seção de restrições do formato lp: o início da primeira linha que
+ * @desc começa com outra seção (ou o fim do conteúdo)
+ *
+ * @returns const char*
+ */
+const char* Parser::findConstraintsEnd() {
+    const char *position = this->current, *lineStart = this->current, *next;
+
+    while(true) {
+        this->current = lineStart;
+        while(this->current != this->end && (*this->current == ' ' || *this->current == '\t' || *this->current == '\r')) {
+            this->current++;
+        }
+        if(this->readSection() != 0) {
+            this->current = position;
+            return lineStart;
+        }
+        next = (const char*) memchr(lineStart, '\n', this->end - lineStart);
+        if(next == NULL) {
+            break;
+        }
+        lineStart = next + 1;
+    }
+    this->current = position;
+    return this->end;
+}
+
+/**
+ * @desc Avança até o início da próxima linha em que uma restrição termina (no formato livre,
+ * @desc qualquer linha)
+ *
+ * @param const char *position posição de onde procurar
+ * @param const char *regionEnd fim da seção de restrições
+ * @param bool lineBased true se cada restrição ocupa exatamente uma linha
+ * @returns const char* início do próximo bloco
+ */
+const char* Parser::findChunkEnd(const char *position, const char *regionEnd, bool lineBased) {
+    const char *lineStart = position, *next;
+
+    while(position != regionEnd) {
+        next = (const char*) memchr(position, '\n', regionEnd - position);
+        if(next == NULL) {
+            return regionEnd;
+        }
+        position = next + 1;
+        if(lineBased || Parser::endsConstraint(lineStart, next)) {
+            return position;
+        }
+    }
+    return regionEnd;
+}
+
+/**
+ * @desc Verifica se a linha termina uma restrição do formato lp: o último termo é um número
+ * @desc logo depois de uma relação, e a linha não tem comentário (que poderia imitar esse fim)
+ *
+ * @param const char *begin limite da busca para trás
+ * @param const char *lineEnd posição do '\n' da linha
+ * @returns bool
+ */
+bool Parser::endsConstraint(const char *begin, const char *lineEnd) {
+    const char *position = lineEnd;
+    bool digits = false;
+
+    while(position != begin && (position[-1] == ' ' || position[-1] == '\t' || position[-1] == '\r')) {
+        position--;
+    }
+    while(position != begin && (isdigit(position[-1]) || position[-1] == '.' || position[-1] == 'e' || position[-1] == 'E'
+        || position[-1] == '+' || position[-1] == '-')) {
+        digits = digits || isdigit(position[-1]);
+        position--;
+    }
+    if(!digits) {
+        return false;
+    }
+    while(position != begin && (position[-1] == ' ' || position[-1] == '\t')) {
+        position--;
+    }
+    if(position == begin || (position[-1] != '<' && position[-1] != '>' && position[-1] != '=')) {
+        return false;
+    }
+    while(position != begin && position[-1] != '\n') {
+        if(position[-1] == '\\') {
+            return false;
+        }
+        position--;
+    }
+    return true;
+}
+
+/**
+ * @desc Executa o trabalho em cada bloco [blocks[k], blocks[k+1]) em uma thread própria
+ * @desc (com um bloco só, na thread atual)
+ *
+ * @param const vector<long long> &blocks limites dos blocos
+ * @param const function<void(long long, long long)> &work trabalho de um bloco
+ * @returns void
+ */
+void Parser::runBlocks(const vector<long long> &blocks, const function<void(long long, long long)> &work) {
+    vector<thread> threads;
+
+    if(blocks.size() <= 2) {
+        if(blocks.size() == 2) {
+            work(blocks[0], blocks[1]);
+        }
+        return;
+    }
+    for(size_t k = 0; k + 1 < blocks.size(); k++) {
+        threads.push_back(thread(work, blocks[k], blocks[k+1]));
+    }
+    for(size_t k = 0; k < threads.size(); k++) {
+        threads[k].join();
+    }
+}
+
+/**
+ * @desc Lê um limite da seção Bounds: "x <= u", "l <= x", "l <= x <= u" ou "x free"
+ *
+ * @returns void
+ */
+void Parser::parseBound() {
+    double infinity = numeric_limits<double>::infinity();
+    const char *position = this->current;
+    long long column;
+    double value;
+    int relation;
+    bool infinite;
+
+    //"inf" e "infinity" são valores, não nomes de variáveis
+    infinite = this->readKeyword("infinity") || this->readKeyword("inf");
+    this->current = position;
+    if(this->isVariable() && !infinite) {
+        column = this->readVariable();
+        this->skipBlank(false);
+        if(this->readKeyword("free")) {
+            this->setBound(column, 1, -infinity);
+            this->setBound(column, 0, infinity);
+            return;
+        }
+        relation = this->readRelation(true);
+        this->setBound(column, relation, this->readValue(true));
+        return;
+    }
+
+    //o número vem antes da variável: "l <= x" equivale a "x >= l"
+    value = this->readValue(true);
+    relation = this->readRelation(true);
+    this->skipBlank(false);
+    if(!this->isVariable()) {
+        this->error();
+    }
+    column = this->readVariable();
+    this->setBound(column, (relation == 2) ? 2 : 1 - relation, value);
+
+    this->skipBlank(false);
+    if(this->current != this->end && (*this->current == '<' || *this->current == '>' || *this->current == '=')) {
+        relation = this->readRelation(true);
+        this->setBound(column, relation, this->readValue(true));
+    }
+}
+
+/**
+ * @desc Lê um nome das seções Generals ou Binaries e marca a integralidade da variável
+ *
+ * @param int type GENERAL_VARIABLE ou BINARY_VARIABLE
+ * @returns void
+ */
+void Parser::parseVariableType(int type) {
+    long long column;
+
+    if(!this->isVariable()) {
+        this->error();
+    }
+    column = this->readVariable();
+    if(column >= (long long) this->variableTypes.size()) {
+        this->variableTypes.resize(column + 1, CONTINUOUS_VARIABLE);
+    }
+    this->variableTypes[column] = type;
+    this->hasIntegrality = true;
+}
+
+/**
+ * @desc Lê uma expressão linear "[+-] [coeficiente] x<índice> ..." e guarda os termos como triplas
+ * @desc da linha (ou na função objetivo). Para antes da relação, de uma seção ou do fim da linha.
+ *
+ * @param long long row linha da restrição (-1 para a função objetivo)
+ * @param bool lineBased true se a expressão não pode continuar na linha seguinte
+ * @returns void
+ */
+void Parser::readExpression(long long row, bool lineBased) {
+    const char *position;
+    double sign, coefficient;
+    long long column;
+    bool hasSign, hasNumber, first = true;
+
+    while(true) {
+        //no formato lp a expressão continua na linha seguinte, a menos que ela comece uma seção
+        if(this->skipBlank(!lineBased)) {
+            position = this->current;
+            if(this->readSection() != 0) {
+                this->current = position;
+                return;
+            }
+        }
+
+        sign = 1;
+        hasSign = false;
+        while(this->current != this->end && (*this->current == '+' || *this->current == '-')) {
+            if(*this->current == '-') {
+                sign = -sign;
+            }
+            hasSign = true;
+            this->current++;
+            this->skipBlank(!lineBased);
+        }
+        //os termos seguintes ao primeiro precisam de um operador
+        if(!hasSign && !first) {
+            return;
+        }
+
+        coefficient = 1;
+        hasNumber = Parser::readNumber(this->current, this->end, coefficient);
+        if(hasNumber) {
+            this->skipBlank(!lineBased);
+            if(this->current != this->end && *this->current == '*') {
+                this->current++;
+                this->skipBlank(!lineBased);
+            }
+        }
+
+        if(!this->isVariable()) {
+            if(hasSign || hasNumber) {
+                this->error();
+            }
+            return;
+        }
+        column = this->readVariable();
+        if(coefficient != 0) {
+            if(row == -1) {
+                this->objective.push_back(make_pair(column, sign * coefficient));
+            } else {
+                this->coefficients.push_back(Triplet<double>(row, column, sign * coefficient));
+            }
+        }
+        first = false;
+    }
+}
+
+/**
+ * @desc Lê uma relação: <, <=, =<, >, >=, => ou =
+ *
+ * @param bool lineBased true se a relação deve estar na linha atual
+ * @returns int {0 -> <=; 1 -> >=; 2 -> =}
+ */
+int Parser::readRelation(bool lineBased) {
+    int relation = 0;
+
+    this->skipBlank(!lineBased);
+    if(this->current == this->end) {
+        this->error();
+    }
+    switch(*this->current) {
+        case '<':
+            relation = 0;
+            break;
+        case '>':
+            relation = 1;
+            break;
+        case '=':
+            relation = 2;
+            break;
+        default:
+            this->error();
+    }
+    this->current++;
+
+    if(this->current != this->end && relation == 2 && (*this->current == '<' || *this->current == '>')) {
+        relation = (*this->current == '<') ? 0 : 1;
+        this->current++;
+    } else if(this->current != this->end && *this->current == '=') {
+        this->current++;
+    }
+    return relation;
+}
+
+/**
+ * @desc Lê um valor com sinal: número, "inf" ou "infinity"
+ *
+ * @param bool lineBased true se o valor deve estar na linha atual
+ * @returns double
+ */
+double Parser::readValue(bool lineBased) {
+    double sign = 1, value;
+
+    this->skipBlank(!lineBased);
+    while(this->current != this->end && (*this->current == '+' || *this->current == '-')) {
+        if(*this->current == '-') {
+            sign = -sign;
+        }
+        this->current++;
+        this->skipBlank(!lineBased);
+    }
+    if(this->readKeyword("infinity") || this->readKeyword("inf")) {
+        return sign * numeric_limits<double>::infinity();
+    }
+    if(!Parser::readNumber(this->current, this->end, value)) {
+        this->error();
+    }
+    return sign * value;
+}
+
+/**
+ * @desc Lê um número sem sinal (inteiro, decimal ou com expoente) direto do conteúdo. Com até
+ * @desc 15 dígitos significativos e expoente pequeno a conversão é exata; nos outros casos
+ * @desc o trecho é convertido por strtod.
+ *
+ * @param const char *&current posição atual (avança até o fim do número)
+ * @param const char *end fim do conteúdo
+ * @param double &value recebe o número
+ * @returns bool false se não há número na posição atual
+ */
+bool Parser::readNumber(const char *&current, const char *end, double &value) {
+    const char *start = current, *mark;
+    unsigned long long mantissa = 0;
+    int digits = 0, exponent = 0, power = 0, exponentSign = 1;
+    bool found = false;
+
+    while(current != end && isdigit(*current)) {
+        if(digits < 19) {
+            mantissa = mantissa * 10 + (*current - '0');
+            digits += (mantissa > 0);
+        } else {
+            exponent++;
+        }
+        found = true;
+        current++;
+    }
+    if(current != end && *current == '.') {
+        current++;
+        while(current != end && isdigit(*current)) {
+            if(digits < 19) {
+                mantissa = mantissa * 10 + (*current - '0');
+                digits += (mantissa > 0);
+                exponent--;
+            }
+            found = true;
+            current++;
+        }
+    }
+    if(!found) {
+        current = start;
+        return false;
+    }
+
+    if(current != end && (*current == 'e' || *current == 'E')) {
+        mark = current++;
+        if(current != end && (*current == '+' || *current == '-')) {
+            exponentSign = (*current == '-') ? -1 : 1;
+            current++;
+        }
+        if(current == end || !isdigit(*current)) {
+            //não é um expoente ("e" faz parte do que vem depois)
+            current = mark;
+        } else {
+            while(current != end && isdigit(*current)) {
+                if(power < 100000) {
+                    power = power * 10 + (*current - '0');
+                }
+                current++;
+            }
+            exponent += exponentSign * power;
+        }
+    }
+
+    if(mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        value = (exponent >= 0) ? mantissa * POWERS_OF_TEN[exponent] : mantissa / POWERS_OF_TEN[-exponent];
+    } else {
+        value = strtod(string(start, current).c_str(), NULL);
+    }
+    return true;
+}
+
+/**
+ * @desc Lê o nome de uma variável e o busca (ou cria) na tabela de símbolos
+ *
+ * @returns long long identificador da variável (ordem da primeira ocorrência)
+ */
+long long Parser::readVariable() {
+    const char *position = this->current;
+
+    while(this->current != this->end && Parser::isNameCharacter(*this->current)) {
+        this->current++;
+    }
+    return this->symbols.intern(position, this->current);
+}
+
+/**
+ * @desc Verifica se a posição atual começa o nome de uma variável (não começa por dígito nem ponto)
+ *
+ * @returns bool
+ */
+bool Parser::isVariable() {
+    return this->current != this->end && Parser::isNameCharacter(*this->current) && !isdigit(*this->current)
+        && *this->current != '.';
+}
+
+/**
+ * @desc Verifica se o caractere pode fazer parte do nome de uma variável no formato lp
+ *
+ * @param char character
+ * @returns bool
+ */
+bool Parser::isNameCharacter(char character) {
+    //todos os visíveis, menos os operadores, relações, ':' e '\'
+    return isalnum((unsigned char) character) || (character > ' ' && character < 127 && strchr("*+-:<=>[\\]^", character) == NULL);
+}
+
+/**
+ * @desc Verifica se o nome tem a forma x<índice> (ou X<índice>), com índice a partir de 1
+ *
+ * @param const string &name
+ * @param long long &index recebe o índice
+ * @returns bool
+ */
+bool Parser::isNumberedName(const string &name, long long &index) {
+    if(name.size() < 2 || name.size() > 19 || toupper(name[0]) != 'X') {
+        return false;
+    }
+    index = 0;
+    for(size_t k = 1; k < name.size(); k++) {
+        if(!isdigit(name[k])) {
+            return false;
+        }
+        index = index * 10 + (name[k] - '0');
+    }
+    return index >= 1;
+}
+
+/**
+ * @desc Pula o nome "rótulo:" de uma restrição ou da função objetivo, se houver
+ *
+ * @returns void
+ */
+void Parser::readLabel() {
+    const char *position = this->current;
+
+    while(this->current != this->end && !isspace(*this->current) && *this->current != ':' && *this->current != '<'
+        && *this->current != '>' && *this->current != '=' && *this->current != '+' && *this->current != '-') {
+        this->current++;
+    }
+    this->skipBlank(false);
+    if(this->current != this->end && *this->current == ':') {
+        this->current++;
+    } else {
+        this->current = position;
+    }
+}
+
+/**
+ * @desc Reconhece uma palavra-chave de seção do formato lp na posição atual e a consome
+ *
+ * @returns int CONSTRAINTS_SECTION, BOUNDS_SECTION, GENERALS_SECTION, BINARIES_SECTION, END_SECTION ou 0 se não há seção
+ */
+int Parser::readSection() {
+    if(this->format != LP_FORMAT) {
+        return 0;
+    }
+    if(this->readKeyword("subject to") || this->readKeyword("such that") || this->readKeyword("s.t.")
+        || this->readKeyword("st")) {
+        return CONSTRAINTS_SECTION;
+    }
+    if(this->readKeyword("bounds") || this->readKeyword("bound")) {
+        return BOUNDS_SECTION;
+    }
+    if(this->readKeyword("generals") || this->readKeyword("general") || this->readKeyword("gen")) {
+        return GENERALS_SECTION;
+    }
+    if(this->readKeyword("binaries") || this->readKeyword("binary") || this->readKeyword("bin")) {
+        return BINARIES_SECTION;
+    }
+    if(this->readKeyword("end")) {
+        return END_SECTION;
+    }
+    return 0;
+}
+
+/**
+ * @desc Consome a palavra-chave (sem diferenciar maiúsculas; um espaço na palavra aceita vários
+ * @desc espaços) se ela estiver na posição atual seguida de um separador
+ *
+ * @param const char *keyword palavra-chave em minúsculas
+ * @returns bool true se a palavra foi consumida
+ */
+bool Parser::readKeyword(const char *keyword) {
+    const char *position = this->current;
+
+    for(; *keyword != '\0'; keyword++) {
+        if(*keyword == ' ') {
+            if(this->current == this->end || (*this->current != ' ' && *this->current != '\t')) {
+                this->current = position;
+                return false;
+            }
+            while(this->current != this->end && (*this->current == ' ' || *this->current == '\t')) {
+                this->current++;
+            }
+        } else if(this->current != this->end && tolower(*this->current) == *keyword) {
+            this->current++;
+        } else {
+            this->current = position;
+            return false;
+        }
+    }
+    if(this->current != this->end && (isalnum(*this->current) || *this->current == '_' || *this->current == ':')) {
+        this->current = position;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @desc Pula espaços e comentários ('\' no formato lp) e, se permitido, quebras de linha
+ *
+ * @param bool newLines true para pular também as quebras de linha
+ * @returns bool true se alguma quebra de linha foi pulada
+ */
+bool Parser::skipBlank(bool newLines) {
+    bool crossed = false;
+
+    while(this->current != this->end) {
+        if(*this->current == ' ' || *this->current == '\t' || *this->current == '\r') {
+            this->current++;
+        } else if(*this->current == '\\' && this->format == LP_FORMAT) {
+            while(this->current != this->end && *this->current != '\n') {
+                this->current++;
+            }
+        } else if(*this->current == '\n' && newLines) {
+            this->current++;
+            this->line++;
+            crossed = true;
+        } else {
+            break;
+        }
+    }
+    return crossed;
+}
+
+/**
+ * @desc Exige o fim da linha (formato livre)
+ *
+ * @returns void
+ */
+void Parser::expectLineEnd() {
+    this->skipBlank(false);
+    if(this->current != this->end && *this->current != '\n') {
+        this->error();
+    }
+}
+
+/**
+ * @desc Altera o limite de uma variável a partir da relação "x relação valor". Os lados não
+ * @desc escritos ficam NaN, assim outro nome da mesma coluna (X1 e x1) não apaga o limite
+ *
+ * @param long long column
+ * @param int relation {0 -> <=; 1 -> >=; 2 -> =}
+ * @param double value
+ * @returns void
+ */
+void Parser::setBound(long long column, int relation, double value) {
+    if(column >= (long long) this->lowerBounds.size()) {
+        this->lowerBounds.resize(column + 1, numeric_limits<double>::quiet_NaN());
+        this->upperBounds.resize(column + 1, numeric_limits<double>::quiet_NaN());
+    }
+    if(relation == 0 || relation == 2) {
+        this->upperBounds[column] = value;
+    }
+    if(relation == 1 || relation == 2) {
+        this->lowerBounds[column] = value;
+    }
+}
+
+/**
+ * @desc Interrompe a leitura com o número da linha atual
+ *
+ * @returns void
+ */
+void Parser::error() {
+    throw(new Exception("Parser: Erro na linha " + to_string(this->line) + "!"));
+}
+
+/**
+ * @desc Monta o problema lido (o lado direito vai na última coluna da matriz). Se todos os nomes
+ * @desc são x<índice>, com índices distintos e o maior até o dobro do número de variáveis, cada
+ * @desc variável vai para a coluna do índice; senão, as colunas seguem a ordem da tabela de
+ * @desc símbolos (primeira aparição) e os nomes são guardados no problema.
+ *
+ * @returns Problem*
+ */
+Problem* Parser::getProblem() {
+    long long n = 0, m = this->relations.size(), size = this->symbols.size(), index;
+    vector<long long> columns(size);
+    vector<string> names(size);
+    VectorXd relations(m);
+    Problem *problem;
+    bool numbered = true, identity = true;
+
+    if(size == 0) {
+        throw(new Exception("Parser: Nenhuma variavel encontrada!"));
+    }
+
+    for(long long id = 0; id < size; id++) {
+        names[id] = this->symbols.getName(id);
+        if(numbered && Parser::isNumberedName(names[id], index)) {
+            columns[id] = index - 1;
+            n = max(n, index);
+        } else {
+            numbered = false;
+        }
+    }
+    //índices esparsos (x100000000) ou repetidos (x1 e X1) usam colunas densas
+    numbered = numbered && n <= 2 * size;
+    if(numbered) {
+        vector<bool> used(n, false);
+        for(long long id = 0; id < size && numbered; id++) {
+            numbered = !used[columns[id]];
+            used[columns[id]] = true;
+        }
+    }
+    if(!numbered) {
+        n = size;
+        for(long long id = 0; id < size; id++) {
+            columns[id] = id;
+        }
+    }
+    for(long long id = 0; id < size; id++) {
+        identity = identity && columns[id] == id;
+    }
+    if(!identity) {
+        for(size_t k = 0; k < this->coefficients.size(); k++) {
+            this->coefficients[k] = Triplet<double>(this->coefficients[k].row(), columns[this->coefficients[k].col()],
+                this->coefficients[k].value());
+        }
+    }
+
+    VectorXd objectiveFunction = VectorXd::Zero(n);
+    for(size_t k = 0; k < this->objective.size(); k++) {
+        objectiveFunction(columns[this->objective[k].first]) += this->objective[k].second;
+    }
+    for(long long i = 0; i < m; i++) {
+        relations(i) = this->relations[i];
+    }
+
+    problem = new Problem(objectiveFunction, Parser::buildConstraints(this->coefficients, this->rightHandSides, n,
+        this->numberOfThreads), relations);
+
+    //só os lados escritos de cada limite são aplicados
+    VectorXd lower = problem->getLowerBounds(), upper = problem->getUpperBounds();
+    for(size_t id = 0; id < this->lowerBounds.size(); id++) {
+        if(!isnan(this->lowerBounds[id])) {
+            lower(columns[id]) = this->lowerBounds[id];
+        }
+        if(!isnan(this->upperBounds[id])) {
+            upper(columns[id]) = this->upperBounds[id];
+        }
+    }
+    for(long long j = 0; j < n; j++) {
+        problem->setBounds(j, lower(j), upper(j));
+    }
+    //com Generals ou Binaries, as variáveis não listadas são contínuas
+    if(this->hasIntegrality) {
+        vector<int> types(n, CONTINUOUS_VARIABLE);
+        for(size_t id = 0; id < this->variableTypes.size(); id++) {
+            types[columns[id]] = this->variableTypes[id];
+        }
+        for(long long j = 0; j < n; j++) {
+            problem->setVariableType(j, types[j]);
+        }
+    }
+    if(!numbered) {
+        problem->setVariableNames(names);
+    }
+    return problem;
+}
+
+/**
+ * @desc Monta a matriz de restrições a partir de triplas agrupadas por linha (em ordem crescente
+ * @desc de linha): a matriz comprimida por linhas é preenchida diretamente, cada linha é ordenada
+ * @desc por coluna, coeficientes repetidos são somados e o lado direito vai na última coluna.
+ * @desc Com várias threads, cada uma ordena e copia um bloco de linhas com quantidades parecidas de triplas.
+ *
+ * @param vector<Triplet<double> > &coefficients triplas agrupadas por linha (cada linha é reordenada no lugar)
+ * @param const vector<double> &rightHandSides lado direito de cada linha
+ * @param long long numberOfVariables
+ * @param int numberOfThreads
+ * @returns SparseMatrixXd
+ */
+SparseMatrixXd Parser::buildConstraints(vector<Triplet<double> > &coefficients, const vector<double> &rightHandSides,
+    long long numberOfVariables, int numberOfThreads) {
+    long long m = rightHandSides.size(), threads;
+    SparseMatrixXd constraints(m, numberOfVariables + 1);
+    vector<size_t> starts(m + 1, 0), counts(m);
+    vector<long long> blocks;
+    size_t size = 0;
+
+    //início de cada linha nas triplas
+    for(size_t k = 0; k < coefficients.size(); k++) {
+        starts[coefficients[k].row() + 1]++;
+    }
+    for(long long i = 0; i < m; i++) {
+        starts[i+1] += starts[i];
+    }
+
+    threads = min((long long) max(numberOfThreads, 1),
+        (long long) (coefficients.size() * PARSER_BYTES_PER_COEFFICIENT / PARSER_MIN_CHUNK_BYTES) + 1);
+    blocks.push_back(0);
+    for(long long t = 1; t < threads; t++) {
+        blocks.push_back(max(blocks.back(), (long long) (lower_bound(starts.begin(), starts.end(),
+            coefficients.size() * t / threads) - starts.begin())));
+    }
+    blocks.push_back(m);
+
+    //ordena cada linha por coluna e soma os repetidos no próprio vetor de triplas
+    Parser::runBlocks(blocks, [&](long long first, long long last) {
+        size_t position;
+        for(long long i = first; i < last; i++) {
+            sort(coefficients.begin() + starts[i], coefficients.begin() + starts[i+1],
+                [](const Triplet<double> &a, const Triplet<double> &b) { return a.col() < b.col(); });
+            position = starts[i];
+            for(size_t k = starts[i]; k < starts[i+1]; k++) {
+                if(position > starts[i] && coefficients[position-1].col() == coefficients[k].col()) {
+                    coefficients[position-1] = Triplet<double>(i, coefficients[k].col(),
+                        coefficients[position-1].value() + coefficients[k].value());
+                } else {
+                    coefficients[position++] = coefficients[k];
+                }
+            }
+            counts[i] = position - starts[i];
+        }
+    });
+
+    for(long long i = 0; i < m; i++) {
+        constraints.outerIndexPtr()[i] = size;
+        size += counts[i] + (rightHandSides[i] != 0);
+    }
+    constraints.outerIndexPtr()[m] = size;
+    constraints.resizeNonZeros(size);
+
+    Parser::runBlocks(blocks, [&](long long first, long long last) {
+        size_t position;
+        for(long long i = first; i < last; i++) {
+            position = constraints.outerIndexPtr()[i];
+            for(size_t k = starts[i]; k < starts[i] + counts[i]; k++) {
+                constraints.innerIndexPtr()[position] = coefficients[k].col();
+                constraints.valuePtr()[position] = coefficients[k].value();
+                position++;
+            }
+            if(rightHandSides[i] != 0) {
+                constraints.innerIndexPtr()[position] = numberOfVariables;
+                constraints.valuePtr()[position] = rightHandSides[i];
+            }
+        }
+    });
+    return constraints;
+}
+
+/**
+ * @desc Retorna o modo lido (1 minimização, 2 maximização)
+ *
+ * @returns int
+ */
+int Parser::getMode() {
+    return this->mode;
+}
+
+/**
+ * @desc Retorna o número de linhas lidas
+ *
+ * @returns long long
+ */
+long long Parser::getLines() {
+    return this->line;
+}
+
+/**
+ * @desc Retorna o número de coeficientes não nulos das restrições
+ *
+ * @returns long long
+ */
+long long Parser::getNonzeros() {
+    return this->coefficients.size();
+}
+
+/**
+ * @desc Retorna em quantos blocos as restrições foram lidas (1 na leitura sequencial)
+ *
+ * @returns int
+ */
+int Parser::getChunks() {
+    return this->numberOfChunks;
+}
@@ -0,0 +1,286 @@
+#include "../headers/Portfolio.h"
+#include <Eigen>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: cria as estratégias, executa cada uma na sua thread e espera todas
+ * @desc terminarem (as perdedoras são canceladas assim que alguma prova o resultado)
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira resolvido por todas as estratégias
+ * @param int mode Pode ser: MINIMIZE, MAXIMIZE
+ * @param int numberOfStrategies número de estratégias (threads) do portfólio
+ * @param int engine método de resolução das relaxações: TABLEAU_ENGINE, REVISED_ENGINE
+ * @param int nodeSelection política de seleção de nós da primeira estratégia
+ * @param int branching regra de ramificação da primeira estratégia
+ * @param bool useHeuristics true para executar as heurísticas primais nos branch-and-bounds
+ * @param int cuts separação de cortes da primeira estratégia: NO_CUTS, ROOT_CUTS, TREE_CUTS
+ * @param long long cutDepth profundidade máxima dos nós com separação (TREE_CUTS)
+ * @param long long cutRounds rodadas de separação na raiz
+ * @param bool usePropagation true para propagar os limites nos nós dos branch-and-bounds
+ * @param double relativeGap gap relativo que encerra cada branch-and-bound
+ * @param double absoluteGap gap absoluto que encerra cada branch-and-bound
+ * @param Limits *limits orçamento compartilhado por todas as estratégias (NULL sem limites)
+ */
+Portfolio::Portfolio(Problem *ilp, int mode, int numberOfStrategies, int engine, int nodeSelection, int branching,
+    bool useHeuristics, int cuts, long long cutDepth, long long cutRounds, bool usePropagation, double relativeGap,
+    double absoluteGap, Limits *limits) {
+    vector<thread> threads;
+
+    this->ilp = ilp;
+    this->mode = mode;
+    this->engine = engine;
+    this->useHeuristics = useHeuristics;
+    this->usePropagation = usePropagation;
+    this->cutDepth = cutDepth;
+    this->cutRounds = cutRounds;
+    this->relativeGap = relativeGap;
+    this->absoluteGap = absoluteGap;
+    this->limits = limits;
+    this->incumbent = new Incumbent(mode);
+    this->winner = -1;
+    this->status = INFEASIBLE;
+    this->dualBound = (mode == MAXIMIZE) ? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity();
+
+    this->createStrategies(numberOfStrategies, nodeSelection, branching, cuts);
+
+    for(size_t i = 0; i < this->strategies.size(); i++) {
+        threads.push_back(thread(&Portfolio::run, this, i));
+    }
+    for(size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    this->collect();
+}
+
+/**
+ * @desc Destrutor: libera os métodos e os orçamentos das estratégias
+ */
+Portfolio::~Portfolio() {
+    for(size_t i = 0; i < this->strategies.size(); i++) {
+        delete this->strategies[i]->bb;
+        delete this->strategies[i]->cp;
+        delete this->strategies[i]->limits;
+        delete this->strategies[i];
+    }
+    delete this->incumbent;
+}
+
+/**
+ * @desc Monta as estratégias: a primeira é o branch-and-bound com a configuração pedida, a
+ * @desc segunda é o planos de corte e as demais são branch-and-bounds com outras políticas de
+ * @desc seleção, regras de ramificação, cortes e sementes (a lista é percorrida em ciclo).
+ *
+ * @param int numberOfStrategies
+ * @param int nodeSelection política de seleção da primeira estratégia
+ * @param int branching regra de ramificação da primeira estratégia
+ * @param int cuts separação de cortes da primeira estratégia
+ * @returns void
+ */
+void Portfolio::createStrategies(int numberOfStrategies, int nodeSelection, int branching, int cuts) {
+    //configurações complementares: mergulho sem cortes, profundidade pura e melhor estimativa com cortes na árvore
+    int selections[] = {HYBRID, DEPTH_FIRST, BEST_ESTIMATE};
+    int branchings[] = {PSEUDOCOST, MOST_FRACTIONAL, RELIABILITY};
+    int cutModes[] = {NO_CUTS, ROOT_CUTS, TREE_CUTS};
+    int k;
+
+    this->addStrategy(BRANCH_AND_BOUND_METHOD, nodeSelection, branching, cuts, HEURISTIC_SEED);
+    if(numberOfStrategies > 1) {
+        this->addStrategy(CUTTING_PLANE_METHOD, 0, 0, 0, 0);
+    }
+    for(int i = 2; i < numberOfStrategies; i++) {
+        k = (i - 2) % 3;
+        this->addStrategy(BRANCH_AND_BOUND_METHOD, selections[k], branchings[k], cutModes[k], HEURISTIC_SEED + PORTFOLIO_SEED_STEP * i);
+    }
+}
+
+/**
+ * @desc Cria uma estratégia com o seu orçamento, filho do orçamento do portfólio
+ *
+ * @param int method BRANCH_AND_BOUND_METHOD ou CUTTING_PLANE_METHOD
+ * @param int nodeSelection
+ * @param int branching
+ * @param int cuts
+ * @param int seed semente das heurísticas primais
+ * @returns void
+ */
+void Portfolio::addStrategy(int method, int nodeSelection, int branching, int cuts, int seed) {
+    const char *selectionNames[] = {"", "best-bound", "depth-first", "best-estimate", "hybrid"};
+    const char *branchingNames[] = {"", "most-fractional", "pseudocost", "strong", "reliability"};
+    const char *cutNames[] = {"off", "root", "tree"};
+    Strategy *strategy = new Strategy();
+
+    strategy->method = method;
+    strategy->nodeSelection = nodeSelection;
+    strategy->branching = branching;
+    strategy->cuts = cuts;
+    strategy->seed = seed;
+    strategy->limits = new Limits(NO_LIMIT, NO_LIMIT, NO_LIMIT, NO_LIMIT, this->limits);
+    strategy->bb = NULL;
+    strategy->cp = NULL;
+    strategy->status = INFEASIBLE;
+    strategy->time = 0;
+    if(method == CUTTING_PLANE_METHOD) {
+        strategy->name = "planos de corte";
+    } else {
+        strategy->name = string("branch-and-bound ") + selectionNames[nodeSelection] + ", " + branchingNames[branching]
+            + ", cortes " + cutNames[cuts] + ", semente " + to_string(seed);
+    }
+    this->strategies.push_back(strategy);
+}
+
+/**
+ * @desc Executa uma estratégia. Se ela provar o resultado antes das outras, vence e cancela as demais.
+ *
+ * @param int index índice da estratégia
+ * @returns void
+ */
+void Portfolio::run(int index) {
+    Strategy *strategy = this->strategies[index];
+    int expected = -1;
+
+    if(strategy->method == BRANCH_AND_BOUND_METHOD) {
+        strategy->bb = new BranchBound(this->ilp, this->mode, this->engine, strategy->nodeSelection, 1, strategy->branching,
+            this->useHeuristics, strategy->cuts, this->cutDepth, this->cutRounds, this->usePropagation, this->relativeGap,
+            this->absoluteGap, strategy->limits, this->incumbent, strategy->seed);
+        strategy->status = strategy->bb->getStatus();
+    } else {
+        strategy->cp = new CuttingPlane(this->ilp, this->mode, strategy->limits);
+        strategy->status = strategy->cp->getStatus();
+        if(strategy->cp->hasSolution()) {
+            this->incumbent->offer(strategy->cp->getSolution(), strategy->cp->getOptimum());
+        }
+    }
+    strategy->time = strategy->limits->getElapsedTime();
+
+    if(strategy->status != OPTIMAL && strategy->status != INFEASIBLE && strategy->status != UNBOUNDED) {
+        return;
+    }
+    if(this->winner.compare_exchange_strong(expected, index)) {
+        for(size_t i = 0; i < this->strategies.size(); i++) {
+            if((int) i != index) {
+                this->strategies[i]->limits->cancel();
+            }
+        }
+    }
+}
+
+/**
+ * @desc Junta os resultados: a situação e o limite dual da vencedora ou, sem vencedora, o
+ * @desc limite dual mais apertado entre as estratégias interrompidas
+ *
+ * @returns void
+ */
+void Portfolio::collect() {
+    Strategy *strategy = this->getWinner();
+    double bound;
+
+    if(strategy != NULL) {
+        this->status = strategy->status;
+        this->dualBound = (strategy->bb != NULL) ? strategy->bb->getDualBound() : strategy->cp->getDualBound();
+        return;
+    }
+
+    this->status = STALLED;
+    for(size_t i = 0; i < this->strategies.size(); i++) {
+        strategy = this->strategies[i];
+        if(strategy->status == LIMIT_REACHED) {
+            this->status = LIMIT_REACHED;
+        }
+        bound = (strategy->bb != NULL) ? strategy->bb->getDualBound() : strategy->cp->getDualBound();
+        if(this->isBetterBound(bound, this->dualBound)) {
+            this->dualBound = bound;
+        }
+    }
+}
+
+/**
+ * @desc Verifica se o primeiro limite dual é mais apertado que o segundo
+ *
+ * @param double first
+ * @param double second
+ * @returns bool
+ */
+bool Portfolio::isBetterBound(double first, double second) {
+    return (this->mode == MAXIMIZE) ? first < second : first > second;
+}
+
+/**
+ * @desc Verifica se alguma estratégia encontrou uma solução inteira
+ *
+ * @returns bool
+ */
+bool Portfolio::hasSolution() {
+    return this->incumbent->hasSolution();
+}
+
+/**
+ * @desc Retorna a situação do resultado: a da estratégia vencedora ou, sem vencedora,
+ * @desc LIMIT_REACHED (ou STALLED se nenhuma estratégia foi interrompida por um limite)
+ *
+ * @returns int
+ */
+int Portfolio::getStatus() {
+    return this->status;
+}
+
+/**
+ * @desc Retorna o valor da melhor solução encontrada entre as estratégias
+ *
+ * @returns double
+ */
+double Portfolio::getOptimum() {
+    return this->incumbent->getValue();
+}
+
+/**
+ * @desc Retorna a melhor solução encontrada entre as estratégias
+ *
+ * @returns VectorXd
+ */
+VectorXd Portfolio::getSolution() {
+    return this->incumbent->getSolution();
+}
+
+/**
+ * @desc Retorna o limite dual do resultado
+ *
+ * @returns double
+ */
+double Portfolio::getDualBound() {
+    return this->dualBound;
+}
+
+/**
+ * @desc Retorna o gap relativo entre a melhor solução e o limite dual
+ *
+ * @returns double
+ */
+double Portfolio::getGap() {
+    if(!this->hasSolution()) {
+        return numeric_limits<double>::infinity();
+    }
+    return fabs(this->getOptimum() - this->dualBound) / (GAP_EPSILON + fabs(this->getOptimum()));
+}
+
+/**
+ * @desc Retorna a estratégia que provou o resultado (NULL se nenhuma provou)
+ *
+ * @returns Strategy*
+ */
+Strategy* Portfolio::getWinner() {
+    return (this->winner == -1) ? NULL : this->strategies[this->winner];
+}
+
+/**
+ * @desc Retorna as estratégias, na ordem de criação
+ *
+ * @returns vector<Strategy*>
+ */
+vector<Strategy*> Portfolio::getStrategies() {
+    return this->strategies;
+}
@@ -0,0 +1,938 @@
+#include "../headers/Presolve.h"
+#include <Eigen>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: aplica as reduções até nenhuma passada alterar o problema (ou até
+ * @desc PRESOLVE_PASSES passadas) e monta o problema reduzido
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira original
+ * @param int mode Pode ser: MINIMIZE, MAXIMIZE
+ * @param bool enabled false para resolver o problema original sem reduções
+ */
+Presolve::Presolve(Problem *ilp, int mode, bool enabled) {
+    bool changed;
+
+    this->original = ilp;
+    this->reduced = ilp;
+    this->mode = mode;
+    this->infeasible = false;
+    this->offset = 0;
+    this->tightenedBounds = 0;
+    this->tightenedCoefficients = 0;
+    this->numberOfVariables = ilp->getObjectiveFunction().rows();
+    this->numberOfRows = ilp->getConstraints().rows();
+
+    //sem reduções o problema original é repassado, a menos que tenha colunas sem limite inferior
+    //ou colunas inteiras com limites fracionários
+    VectorXd lower = ilp->getLowerBounds(), upper = ilp->getUpperBounds();
+    bool rewrite = !lower.allFinite();
+    for(long long j = 0; j < this->numberOfVariables && !rewrite; j++) {
+        rewrite = ilp->isInteger(j) && (lower(j) != floor(lower(j)) || (!isinf(upper(j)) && upper(j) != floor(upper(j))));
+    }
+    if(!enabled && !rewrite) {
+        for(long long j = 0; j < this->numberOfVariables; j++) {
+            this->columnMap.push_back(j);
+            this->columnSigns.push_back(1);
+        }
+        return;
+    }
+
+    this->loadProblem();
+    for(long long pass = 0; pass < PRESOLVE_PASSES && enabled && !this->infeasible; pass++) {
+        changed = this->presolveRows();
+        changed = this->presolveColumns() || changed;
+        changed = this->removeDuplicateRows() || changed;
+        changed = this->removeDuplicateColumns() || changed;
+        if(!changed) {
+            break;
+        }
+    }
+    this->buildProblem();
+}
+
+/**
+ * @desc Destrutor: libera o problema reduzido (o original pertence ao Interpreter)
+ */
+Presolve::~Presolve() {
+    if(this->reduced != this->original) {
+        delete this->reduced;
+    }
+}
+
+/**
+ * @desc Copia o problema original para a representação do presolve: linhas como intervalos
+ * @desc e a lista de linhas de cada coluna
+ *
+ * @returns void
+ */
+void Presolve::loadProblem() {
+    const SparseMatrixXd &constraints = this->original->getConstraints();
+    VectorXd relations = this->original->getRelations();
+    double infinity = numeric_limits<double>::infinity();
+    double rhs;
+
+    this->objectiveFunction = this->original->getObjectiveFunction();
+    this->lowerBounds = this->original->getLowerBounds();
+    this->upperBounds = this->original->getUpperBounds();
+    this->columns.assign(this->numberOfVariables, set<long long>());
+    this->columnActive.assign(this->numberOfVariables, true);
+    this->rows.assign(this->numberOfRows, map<long long, double>());
+    this->rowActive.assign(this->numberOfRows, true);
+
+    for(long long i = 0; i < this->numberOfRows; i++) {
+        rhs = 0;
+        for(SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if(it.col() < this->numberOfVariables) {
+                this->setCoefficient(i, it.col(), it.value());
+            } else {
+                rhs = it.value();
+            }
+        }
+        //relações: 0 (<=), 1 (>=), 2 (=)
+        this->rowLower.push_back(relations(i) == 0 ? -infinity : rhs);
+        this->rowUpper.push_back(relations(i) == 1 ? infinity : rhs);
+    }
+
+    //limites fracionários de colunas inteiras são arredondados para dentro antes das reduções,
+    //assim uma coluna fixada no limite recebe um valor inteiro
+    for(long long j = 0; j < this->numberOfVariables; j++) {
+        if(this->isInteger(j)) {
+            this->setColumnBounds(j, this->lowerBounds(j), this->upperBounds(j));
+        }
+    }
+}
+
+/**
+ * @desc Monta o problema reduzido com as linhas e colunas restantes. Intervalos com os dois
+ * @desc lados finitos viram duas restrições. Como os métodos de resolução exigem ao menos uma
+ * @desc variável e uma restrição, um problema totalmente reduzido (ou inviável) recebe uma
+ * @desc coluna artificial fixa em zero com a restrição x <= 0 (ou x >= 1 se for inviável).
+ * @desc Os métodos exigem limites inferiores finitos: uma coluna só com limite superior entra
+ * @desc negada (x = -x') e uma coluna livre vira duas colunas não negativas (x = x+ - x-).
+ *
+ * @returns void
+ */
+void Presolve::buildProblem() {
+    vector<Triplet<double> > triplets;
+    vector<double> relations;
+    vector<long long> index(this->numberOfVariables, -1);
+    vector<long long> negative(this->numberOfVariables, -1);
+    long long numberOfColumns, numberOfConstraints = 0, artificial = -1;
+    double lower, upper;
+    map<long long, double>::iterator it;
+
+    for(long long j = 0; j < this->numberOfVariables && !this->infeasible; j++) {
+        if(!this->columnActive[j]) {
+            continue;
+        }
+        if(!isinf(this->lowerBounds(j)) || isinf(this->upperBounds(j))) {
+            index[j] = this->columnMap.size();
+            this->columnMap.push_back(j);
+            this->columnSigns.push_back(1);
+        }
+        if(isinf(this->lowerBounds(j))) {
+            negative[j] = this->columnMap.size();
+            this->columnMap.push_back(j);
+            this->columnSigns.push_back(-1);
+        }
+    }
+
+    for(long long i = 0; i < this->numberOfRows && !this->infeasible; i++) {
+        if(!this->rowActive[i]) {
+            continue;
+        }
+        for(int side = 0; side < 2; side++) {
+            double rhs = (side == 0) ? this->rowUpper[i] : this->rowLower[i];
+            if(isinf(rhs) || (side == 1 && this->rowLower[i] == this->rowUpper[i])) {
+                continue;
+            }
+            for(it = this->rows[i].begin(); it != this->rows[i].end(); ++it) {
+                if(index[it->first] >= 0) {
+                    triplets.push_back(Triplet<double>(numberOfConstraints, index[it->first], it->second));
+                }
+                if(negative[it->first] >= 0) {
+                    triplets.push_back(Triplet<double>(numberOfConstraints, negative[it->first], -it->second));
+                }
+            }
+            triplets.push_back(Triplet<double>(numberOfConstraints, -1, rhs));
+            relations.push_back((this->rowLower[i] == this->rowUpper[i]) ? 2 : side);
+            numberOfConstraints++;
+        }
+    }
+
+    if(this->infeasible || this->columnMap.empty() || numberOfConstraints == 0) {
+        artificial = this->columnMap.size();
+        this->columnMap.push_back(-1);
+        this->columnSigns.push_back(1);
+        triplets.push_back(Triplet<double>(numberOfConstraints, artificial, 1));
+        triplets.push_back(Triplet<double>(numberOfConstraints, -1, this->infeasible ? 1 : 0));
+        relations.push_back(this->infeasible ? 1 : 0);
+        numberOfConstraints++;
+    }
+
+    //o lado direito fica na última coluna, conhecida só agora
+    numberOfColumns = this->columnMap.size();
+    for(size_t k = 0; k < triplets.size(); k++) {
+        if(triplets[k].col() == -1) {
+            triplets[k] = Triplet<double>(triplets[k].row(), numberOfColumns, triplets[k].value());
+        }
+    }
+
+    SparseMatrixXd constraints(numberOfConstraints, numberOfColumns + 1);
+    constraints.setFromTriplets(triplets.begin(), triplets.end());
+    VectorXd objectiveFunction = VectorXd::Zero(numberOfColumns);
+    VectorXd relationsVector(numberOfConstraints);
+    for(long long i = 0; i < numberOfConstraints; i++) {
+        relationsVector(i) = relations[i];
+    }
+    for(long long k = 0; k < numberOfColumns; k++) {
+        if(this->columnMap[k] >= 0) {
+            objectiveFunction(k) = this->columnSigns[k] * this->objectiveFunction(this->columnMap[k]);
+        }
+    }
+
+    this->reduced = new Problem(objectiveFunction, constraints, relationsVector);
+    for(long long k = 0; k < numberOfColumns; k++) {
+        if(k == artificial) {
+            this->reduced->setBounds(k, 0, 0);
+        } else {
+            lower = this->lowerBounds(this->columnMap[k]);
+            upper = this->upperBounds(this->columnMap[k]);
+            //coluna negada: -u <= x'; partes de uma coluna livre: 0 <= x+, x-
+            if(isinf(lower)) {
+                lower = isinf(upper) ? 0 : -upper;
+                upper = numeric_limits<double>::infinity();
+            }
+            this->reduced->setBounds(k, lower, upper);
+            this->reduced->setVariableType(k, this->original->getVariableType(this->columnMap[k]));
+        }
+    }
+    for(long long j = 0; j < this->numberOfVariables; j++) {
+        if(index[j] >= 0 && negative[j] >= 0) {
+            this->reduced->setSplitPartner(index[j], negative[j]);
+        }
+    }
+}
+
+/**
+ * @desc Passada pelas linhas: reduções de cada linha e aperto dos seus coeficientes
+ *
+ * @returns bool true se alguma linha mudou
+ */
+bool Presolve::presolveRows() {
+    bool changed = false;
+
+    for(long long i = 0; i < this->numberOfRows && !this->infeasible; i++) {
+        if(!this->rowActive[i]) {
+            continue;
+        }
+        changed = this->presolveRow(i) || changed;
+        if(this->rowActive[i]) {
+            changed = this->tightenCoefficients(i) || changed;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @desc Reduções de uma linha: linha vazia, inviável ou redundante (pelas atividades mínima e
+ * @desc máxima), lado redundante, linha unitária (vira limite da variável), linha dupla de
+ * @desc igualdade (substituição de uma variável) e aperto dos limites das variáveis pela linha
+ *
+ * @param long long row
+ * @returns bool true se a linha ou algum limite mudou
+ */
+bool Presolve::presolveRow(long long row) {
+    double minimum, maximum, residual, bound, a, lower, upper;
+    long long minimumInfinite, maximumInfinite;
+    double infinity = numeric_limits<double>::infinity();
+    bool changed = false;
+    map<long long, double>::iterator it;
+    vector<pair<long long, double> > entries;
+
+    if(this->rows[row].empty()) {
+        if(this->rowLower[row] > PRESOLVE_FEASIBILITY_TOLERANCE || this->rowUpper[row] < -PRESOLVE_FEASIBILITY_TOLERANCE) {
+            this->infeasible = true;
+            return false;
+        }
+        this->removeRow(row);
+        return true;
+    }
+
+    this->getActivity(row, -1, minimum, maximum, minimumInfinite, maximumInfinite);
+    if(minimumInfinite > 0) {
+        minimum = -infinity;
+    }
+    if(maximumInfinite > 0) {
+        maximum = infinity;
+    }
+    if(minimum > this->rowUpper[row] + PRESOLVE_FEASIBILITY_TOLERANCE || maximum < this->rowLower[row] - PRESOLVE_FEASIBILITY_TOLERANCE) {
+        this->infeasible = true;
+        return false;
+    }
+    if(minimum >= this->rowLower[row] - PRESOLVE_TOLERANCE && maximum <= this->rowUpper[row] + PRESOLVE_TOLERANCE) {
+        this->removeRow(row);
+        return true;
+    }
+    if(!isinf(this->rowLower[row]) && minimum >= this->rowLower[row] - PRESOLVE_TOLERANCE) {
+        this->rowLower[row] = -infinity;
+        changed = true;
+    }
+    if(!isinf(this->rowUpper[row]) && maximum <= this->rowUpper[row] + PRESOLVE_TOLERANCE) {
+        this->rowUpper[row] = infinity;
+        changed = true;
+    }
+
+    //linha unitária: a.x em [l, u] é só um limite da variável
+    if(this->rows[row].size() == 1) {
+        it = this->rows[row].begin();
+        lower = this->rowLower[row] / it->second;
+        upper = this->rowUpper[row] / it->second;
+        if(it->second < 0) {
+            swap(lower, upper);
+        }
+        this->setColumnBounds(it->first, lower, upper);
+        this->removeRow(row);
+        return true;
+    }
+
+    if(this->rowLower[row] == this->rowUpper[row] && this->rows[row].size() == 2 && this->substituteDoubleton(row)) {
+        return true;
+    }
+
+    //aperto de limites: cada variável é limitada pela atividade das outras
+    this->getActivity(row, -1, minimum, maximum, minimumInfinite, maximumInfinite);
+    entries.assign(this->rows[row].begin(), this->rows[row].end());
+    for(size_t k = 0; k < entries.size() && !this->infeasible; k++) {
+        long long j = entries[k].first;
+        a = entries[k].second;
+        lower = this->lowerBounds(j);
+        upper = this->upperBounds(j);
+
+        if(!isinf(this->rowUpper[row])) {
+            bound = (a > 0) ? a * lower : a * upper;
+            if(minimumInfinite == 0 || (minimumInfinite == 1 && isinf(bound))) {
+                residual = isinf(bound) ? minimum : minimum - bound;
+                bound = (this->rowUpper[row] - residual) / a;
+                if(a > 0) {
+                    upper = fmin(upper, bound);
+                } else {
+                    lower = fmax(lower, bound);
+                }
+            }
+        }
+        if(!isinf(this->rowLower[row])) {
+            bound = (a > 0) ? a * this->upperBounds(j) : a * this->lowerBounds(j);
+            if(maximumInfinite == 0 || (maximumInfinite == 1 && isinf(bound))) {
+                residual = isinf(bound) ? maximum : maximum - bound;
+                bound = (this->rowLower[row] - residual) / a;
+                if(a > 0) {
+                    lower = fmax(lower, bound);
+                } else {
+                    upper = fmin(upper, bound);
+                }
+            }
+        }
+        //os limites mudaram: a atividade da linha é recalculada para as próximas variáveis
+        if(this->setColumnBounds(j, lower, upper)) {
+            this->getActivity(row, -1, minimum, maximum, minimumInfinite, maximumInfinite);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @desc Linha dupla de igualdade a_j.x_j + a_k.x_k = b com |a_k| = 1 e valores inteiros:
+ * @desc x_k = b/a_k - (a_j/a_k).x_j é inteiro sempre que x_j é, então x_k é substituído em
+ * @desc todas as linhas e na função objetivo e os seus limites passam para x_j
+ *
+ * @param long long row
+ * @returns bool true se a substituição foi feita
+ */
+bool Presolve::substituteDoubleton(long long row) {
+    map<long long, double>::iterator it = this->rows[row].begin();
+    long long j = it->first, k;
+    double aj = it->second, ak, value, coefficient, e, lower, upper;
+    vector<long long> others;
+    PostsolveStep step;
+
+    ++it;
+    k = it->first;
+    ak = it->second;
+    if(fabs(fabs(ak) - 1) > PRESOLVE_TOLERANCE) {
+        swap(j, k);
+        swap(aj, ak);
+    }
+    if(fabs(fabs(ak) - 1) > PRESOLVE_TOLERANCE || !this->isInteger(j) || !this->isInteger(k)
+        || fabs(aj - round(aj)) > PRESOLVE_TOLERANCE || fabs(this->rowLower[row] - round(this->rowLower[row])) > PRESOLVE_TOLERANCE) {
+        return false;
+    }
+
+    value = this->rowLower[row] / ak;
+    coefficient = aj / ak;
+
+    //limites de x_k levados para x_j: l_k <= value - coefficient.x_j <= u_k
+    lower = (value - this->upperBounds(k)) / coefficient;
+    upper = (value - this->lowerBounds(k)) / coefficient;
+    if(coefficient < 0) {
+        swap(lower, upper);
+    }
+
+    step.type = SUBSTITUTED_COLUMN;
+    step.column = k;
+    step.other = j;
+    step.value = value;
+    step.coefficient = coefficient;
+    this->steps.push_back(step);
+
+    this->removeRow(row);
+    others.assign(this->columns[k].begin(), this->columns[k].end());
+    for(size_t r = 0; r < others.size(); r++) {
+        e = this->rows[others[r]][k];
+        this->setCoefficient(others[r], k, 0);
+        this->setCoefficient(others[r], j, (this->rows[others[r]].count(j) ? this->rows[others[r]][j] : 0) - e * coefficient);
+        this->rowLower[others[r]] -= e * value;
+        this->rowUpper[others[r]] -= e * value;
+    }
+    this->offset += this->objectiveFunction(k) * value;
+    this->objectiveFunction(j) -= this->objectiveFunction(k) * coefficient;
+    this->objectiveFunction(k) = 0;
+    this->columnActive[k] = false;
+
+    this->setColumnBounds(j, fmax(lower, this->lowerBounds(j)), fmin(upper, this->upperBounds(j)));
+    return true;
+}
+
+/**
+ * @desc Aperto de coeficientes de uma linha de um lado só (escrita como a.x <= b): se uma
+ * @desc variável binária em um dos valores deixa a linha redundante, o seu coeficiente (e o
+ * @desc lado direito) diminuem até a linha ficar justa, sem mudar as soluções inteiras. Em
+ * @desc linhas inteiras, os coeficientes são divididos pelo mdc e o lado direito arredondado.
+ *
+ * @param long long row
+ * @returns bool true se a linha mudou
+ */
+bool Presolve::tightenCoefficients(long long row) {
+    double minimum, maximum, a, d, divisor = 0;
+    long long minimumInfinite, maximumInfinite, j;
+    map<long long, double>::iterator it;
+    vector<long long> variables;
+    bool changed = false, integral = true;
+
+    if(!isinf(this->rowLower[row]) && isinf(this->rowUpper[row])) {
+        for(it = this->rows[row].begin(); it != this->rows[row].end(); ++it) {
+            it->second = -it->second;
+        }
+        this->rowUpper[row] = -this->rowLower[row];
+        this->rowLower[row] = -numeric_limits<double>::infinity();
+    }
+
+    if(isinf(this->rowLower[row]) && !isinf(this->rowUpper[row])) {
+        for(it = this->rows[row].begin(); it != this->rows[row].end(); ++it) {
+            variables.push_back(it->first);
+        }
+        for(size_t k = 0; k < variables.size(); k++) {
+            j = variables[k];
+            if(!this->isInteger(j) || this->lowerBounds(j) != 0 || this->upperBounds(j) != 1) {
+                continue;
+            }
+            this->getActivity(row, -1, minimum, maximum, minimumInfinite, maximumInfinite);
+            if(maximumInfinite > 0) {
+                break;
+            }
+            a = this->rows[row][j];
+            //a > 0: com x_j = 0 a linha é redundante; a < 0: com x_j = 1 a linha é redundante
+            d = (a > 0) ? this->rowUpper[row] - (maximum - a) : this->rowUpper[row] - (maximum + a);
+            if(d <= PRESOLVE_TOLERANCE) {
+                continue;
+            }
+            if(a > 0) {
+                this->setCoefficient(row, j, a - d);
+                this->rowUpper[row] -= d;
+            } else {
+                this->setCoefficient(row, j, a + d);
+            }
+            this->tightenedCoefficients++;
+            changed = true;
+        }
+    }
+
+    //linha inteira: divide pelo mdc dos coeficientes e arredonda os lados
+    for(it = this->rows[row].begin(); it != this->rows[row].end() && integral; ++it) {
+        integral = this->isInteger(it->first) && fabs(it->second - round(it->second)) < PRESOLVE_TOLERANCE
+            && fabs(it->second) < 1e15;
+        if(integral) {
+            long long x = llabs((long long) round(it->second)), y = (long long) divisor;
+            while(y != 0) {
+                long long t = x % y;
+                x = y;
+                y = t;
+            }
+            divisor = x;
+        }
+    }
+    if(integral && divisor >= 1) {
+        double lower = ceil(this->rowLower[row] / divisor - PRESOLVE_TOLERANCE);
+        double upper = floor(this->rowUpper[row] / divisor + PRESOLVE_TOLERANCE);
+        if(divisor > 1 || lower != this->rowLower[row] || upper != this->rowUpper[row]) {
+            if(divisor > 1) {
+                for(it = this->rows[row].begin(); it != this->rows[row].end(); ++it) {
+                    it->second /= divisor;
+                }
+            }
+            this->rowLower[row] = lower;
+            this->rowUpper[row] = upper;
+            this->tightenedCoefficients++;
+            changed = true;
+        }
+        if(lower > upper) {
+            this->infeasible = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @desc Passada pelas colunas: colunas fixas saem do problema; colunas dominadas (a função
+ * @desc objetivo e todas as linhas favorecem o mesmo limite) são fixadas nesse limite. Uma
+ * @desc coluna vazia é o caso particular sem linhas.
+ *
+ * @returns bool true se alguma coluna foi removida
+ */
+bool Presolve::presolveColumns() {
+    long long downLocks, upLocks;
+    double cost, a;
+    bool changed = false;
+    set<long long>::iterator it;
+
+    for(long long j = 0; j < this->numberOfVariables && !this->infeasible; j++) {
+        if(!this->columnActive[j]) {
+            continue;
+        }
+        if(this->upperBounds(j) - this->lowerBounds(j) <= PRESOLVE_TOLERANCE) {
+            changed = this->fixColumn(j, this->lowerBounds(j)) || changed;
+            continue;
+        }
+
+        //travas: linhas que impedem diminuir (down) ou aumentar (up) a variável
+        downLocks = upLocks = 0;
+        for(it = this->columns[j].begin(); it != this->columns[j].end(); ++it) {
+            a = this->rows[*it][j];
+            if((a > 0 && !isinf(this->rowLower[*it])) || (a < 0 && !isinf(this->rowUpper[*it]))) {
+                downLocks++;
+            }
+            if((a > 0 && !isinf(this->rowUpper[*it])) || (a < 0 && !isinf(this->rowLower[*it]))) {
+                upLocks++;
+            }
+        }
+        cost = this->getCost(j);
+        if(cost >= 0 && downLocks == 0 && !isinf(this->lowerBounds(j))) {
+            changed = this->fixColumn(j, this->lowerBounds(j)) || changed;
+        } else if(cost <= 0 && upLocks == 0 && !isinf(this->upperBounds(j))) {
+            changed = this->fixColumn(j, this->upperBounds(j)) || changed;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @desc Linhas duplicadas (coeficientes proporcionais): os intervalos são intersectados na
+ * @desc primeira e as outras são removidas
+ *
+ * @returns bool true se alguma linha foi removida
+ */
+bool Presolve::removeDuplicateRows() {
+    map<vector<long long>, vector<long long> > supports;
+    map<vector<long long>, vector<long long> >::iterator bucket;
+    map<long long, double>::iterator first, second;
+    vector<long long> support;
+    double ratio, lower, upper;
+    bool changed = false, parallel;
+
+    //linhas vazias ficam para a próxima passada pelas linhas, que as remove ou detecta a inviabilidade
+    for(long long i = 0; i < this->numberOfRows; i++) {
+        if(!this->rowActive[i] || this->rows[i].empty()) {
+            continue;
+        }
+        support.clear();
+        for(first = this->rows[i].begin(); first != this->rows[i].end(); ++first) {
+            support.push_back(first->first);
+        }
+        supports[support].push_back(i);
+    }
+
+    for(bucket = supports.begin(); bucket != supports.end() && !this->infeasible; ++bucket) {
+        vector<long long> &group = bucket->second;
+        for(size_t p = 0; p < group.size(); p++) {
+            long long r1 = group[p];
+            if(!this->rowActive[r1]) {
+                continue;
+            }
+            for(size_t q = p + 1; q < group.size(); q++) {
+                long long r2 = group[q];
+                if(!this->rowActive[r2]) {
+                    continue;
+                }
+                ratio = this->rows[r2].begin()->second / this->rows[r1].begin()->second;
+                parallel = true;
+                for(first = this->rows[r1].begin(), second = this->rows[r2].begin(); first != this->rows[r1].end() && parallel; ++first, ++second) {
+                    parallel = fabs(second->second - ratio * first->second) <= PRESOLVE_TOLERANCE * fabs(second->second);
+                }
+                if(!parallel) {
+                    continue;
+                }
+                lower = this->rowLower[r2] / ratio;
+                upper = this->rowUpper[r2] / ratio;
+                if(ratio < 0) {
+                    swap(lower, upper);
+                }
+                this->rowLower[r1] = fmax(this->rowLower[r1], lower);
+                this->rowUpper[r1] = fmin(this->rowUpper[r1], upper);
+                this->removeRow(r2);
+                changed = true;
+                if(this->rowLower[r1] > this->rowUpper[r1] + PRESOLVE_FEASIBILITY_TOLERANCE) {
+                    this->infeasible = true;
+                    return changed;
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+/**
+ * @desc Colunas duplicadas (mesmos coeficientes, mesmo custo e mesma integralidade): x_j e x_k
+ * @desc só aparecem como x_j + x_k, então viram uma coluna com a soma dos limites. O postsolve
+ * @desc divide o valor da soma entre as duas.
+ *
+ * @returns bool true se alguma coluna foi removida
+ */
+bool Presolve::removeDuplicateColumns() {
+    map<pair<vector<pair<long long, double> >, pair<double, bool> >, long long> keys;
+    map<pair<vector<pair<long long, double> >, pair<double, bool> >, long long>::iterator found;
+    vector<pair<long long, double> > entries;
+    set<long long>::iterator it;
+    vector<long long> rowsOfColumn;
+    PostsolveStep step;
+    long long j;
+    bool changed = false;
+
+    for(long long k = 0; k < this->numberOfVariables; k++) {
+        if(!this->columnActive[k] || this->columns[k].empty()) {
+            continue;
+        }
+        entries.clear();
+        for(it = this->columns[k].begin(); it != this->columns[k].end(); ++it) {
+            entries.push_back(make_pair(*it, this->rows[*it][k]));
+        }
+        pair<vector<pair<long long, double> >, pair<double, bool> > key(entries, make_pair(this->objectiveFunction(k), this->isInteger(k)));
+        found = keys.find(key);
+        if(found == keys.end()) {
+            keys[key] = k;
+            continue;
+        }
+
+        j = found->second;
+        step.type = MERGED_COLUMNS;
+        step.column = k;
+        step.other = j;
+        step.otherLower = this->lowerBounds(j);
+        step.otherUpper = this->upperBounds(j);
+        step.columnLower = this->lowerBounds(k);
+        step.columnUpper = this->upperBounds(k);
+        this->steps.push_back(step);
+
+        this->lowerBounds(j) += this->lowerBounds(k);
+        this->upperBounds(j) += this->upperBounds(k);
+        rowsOfColumn.assign(this->columns[k].begin(), this->columns[k].end());
+        for(size_t r = 0; r < rowsOfColumn.size(); r++) {
+            this->setCoefficient(rowsOfColumn[r], k, 0);
+        }
+        this->columnActive[k] = false;
+        changed = true;
+    }
+    return changed;
+}
+
+/**
+ * @desc Fixa a coluna no valor: o termo vai para os lados das linhas e para a constante da
+ * @desc função objetivo
+ *
+ * @param long long column
+ * @param double value
+ * @returns bool true
+ */
+bool Presolve::fixColumn(long long column, double value) {
+    vector<long long> rowsOfColumn(this->columns[column].begin(), this->columns[column].end());
+    PostsolveStep step;
+    double a;
+
+    step.type = FIXED_COLUMN;
+    step.column = column;
+    step.other = -1;
+    step.value = value;
+    step.coefficient = 0;
+    this->steps.push_back(step);
+
+    for(size_t r = 0; r < rowsOfColumn.size(); r++) {
+        a = this->rows[rowsOfColumn[r]][column];
+        this->rowLower[rowsOfColumn[r]] -= a * value;
+        this->rowUpper[rowsOfColumn[r]] -= a * value;
+        this->setCoefficient(rowsOfColumn[r], column, 0);
+    }
+    this->offset += this->objectiveFunction(column) * value;
+    this->columnActive[column] = false;
+    return true;
+}
+
+/**
+ * @desc Aperta os limites de uma coluna (nunca afrouxa); os limites de variáveis inteiras
+ * @desc são arredondados para dentro
+ *
+ * @param long long column
+ * @param double lower novo limite inferior
+ * @param double upper novo limite superior
+ * @returns bool true se algum limite mudou
+ */
+bool Presolve::setColumnBounds(long long column, double lower, double upper) {
+    bool changed = false;
+
+    if(this->isInteger(column)) {
+        lower = ceil(lower - PRESOLVE_INTEGER_TOLERANCE);
+        upper = floor(upper + PRESOLVE_INTEGER_TOLERANCE);
+    }
+    if(lower > this->lowerBounds(column) + PRESOLVE_TOLERANCE) {
+        this->lowerBounds(column) = lower;
+        changed = true;
+    }
+    if(upper < this->upperBounds(column) - PRESOLVE_TOLERANCE) {
+        this->upperBounds(column) = upper;
+        changed = true;
+    }
+    if(this->lowerBounds(column) > this->upperBounds(column) + PRESOLVE_FEASIBILITY_TOLERANCE) {
+        this->infeasible = true;
+    }
+    if(changed) {
+        this->tightenedBounds++;
+    }
+    return changed;
+}
+
+/**
+ * @desc Altera um coeficiente mantendo a lista de linhas da coluna (valor 0 remove)
+ *
+ * @param long long row
+ * @param long long column
+ * @param double value
+ * @returns void
+ */
+void Presolve::setCoefficient(long long row, long long column, double value) {
+    if(fabs(value) <= PRESOLVE_TOLERANCE) {
+        this->rows[row].erase(column);
+        this->columns[column].erase(row);
+    } else {
+        this->rows[row][column] = value;
+        this->columns[column].insert(row);
+    }
+}
+
+/**
+ * @desc Remove uma linha do problema
+ *
+ * @param long long row
+ * @returns void
+ */
+void Presolve::removeRow(long long row) {
+    map<long long, double>::iterator it;
+
+    for(it = this->rows[row].begin(); it != this->rows[row].end(); ++it) {
+        this->columns[it->first].erase(row);
+    }
+    this->rows[row].clear();
+    this->rowActive[row] = false;
+}
+
+/**
+ * @desc Atividades mínima e máxima da linha: soma das contribuições finitas e número de
+ * @desc contribuições infinitas (limites infinitos)
+ *
+ * @param long long row
+ * @param long long skip coluna ignorada (-1 para nenhuma)
+ * @param double &minimum retorna a soma finita da atividade mínima
+ * @param double &maximum retorna a soma finita da atividade máxima
+ * @param long long &minimumInfinite retorna o número de termos infinitos na mínima
+ * @param long long &maximumInfinite retorna o número de termos infinitos na máxima
+ * @returns void
+ */
+void Presolve::getActivity(long long row, long long skip, double &minimum, double &maximum, long long &minimumInfinite, long long &maximumInfinite) {
+    map<long long, double>::iterator it;
+    double low, high;
+
+    minimum = maximum = 0;
+    minimumInfinite = maximumInfinite = 0;
+    for(it = this->rows[row].begin(); it != this->rows[row].end(); ++it) {
+        if(it->first == skip) {
+            continue;
+        }
+        low = it->second * ((it->second > 0) ? this->lowerBounds(it->first) : this->upperBounds(it->first));
+        high = it->second * ((it->second > 0) ? this->upperBounds(it->first) : this->lowerBounds(it->first));
+        if(isinf(low)) {
+            minimumInfinite++;
+        } else {
+            minimum += low;
+        }
+        if(isinf(high)) {
+            maximumInfinite++;
+        } else {
+            maximum += high;
+        }
+    }
+}
+
+/**
+ * @desc Custo da coluna no sentido de minimização
+ *
+ * @param long long column
+ * @returns double
+ */
+double Presolve::getCost(long long column) {
+    return (this->mode == MAXIMIZE) ? -this->objectiveFunction(column) : this->objectiveFunction(column);
+}
+
+/**
+ * @desc Verifica se a coluna é inteira (segundo a integralidade do problema original)
+ *
+ * @param long long column
+ * @returns bool
+ */
+bool Presolve::isInteger(long long column) {
+    return this->original->isInteger(column);
+}
+
+/**
+ * @desc Leva uma solução do problema reduzido para as variáveis originais, desfazendo as
+ * @desc operações do presolve na ordem inversa
+ *
+ * @param const VectorXd &solution solução do problema reduzido
+ * @returns VectorXd solução nas variáveis originais
+ */
+VectorXd Presolve::postsolve(const VectorXd &solution) {
+    VectorXd values = VectorXd::Zero(this->numberOfVariables);
+    double sum, rest;
+
+    for(size_t k = 0; k < this->columnMap.size() && (long long) k < solution.rows(); k++) {
+        if(this->columnMap[k] >= 0) {
+            values(this->columnMap[k]) += this->columnSigns[k] * solution(k);
+        }
+    }
+
+    for(long long s = (long long) this->steps.size() - 1; s >= 0; s--) {
+        PostsolveStep &step = this->steps[s];
+        if(step.type == FIXED_COLUMN) {
+            values(step.column) = step.value;
+        } else if(step.type == SUBSTITUTED_COLUMN) {
+            values(step.column) = step.value - step.coefficient * values(step.other);
+        } else {
+            //a coluna removida fica num limite finito (ou em zero, se for livre) e a outra leva o resto
+            sum = values(step.other);
+            if(!isinf(step.columnLower)) {
+                rest = step.columnLower;
+            } else if(!isinf(step.columnUpper)) {
+                rest = step.columnUpper;
+            } else {
+                rest = 0;
+            }
+            values(step.other) = fmax(step.otherLower, fmin(step.otherUpper, sum - rest));
+            values(step.column) = sum - values(step.other);
+        }
+    }
+    return values;
+}
+
+/**
+ * @desc Retorna o problema reduzido
+ *
+ * @returns Problem*
+ */
+Problem* Presolve::getProblem() {
+    return this->reduced;
+}
+
+/**
+ * @desc Retorna true se o presolve provou que o problema é inviável
+ *
+ * @returns bool
+ */
+bool Presolve::isInfeasible() {
+    return this->infeasible;
+}
+
+/**
+ * @desc Retorna a constante somada ao valor da função objetivo do problema reduzido
+ * @desc (contribuição das variáveis fixadas ou substituídas)
+ *
+ * @returns double
+ */
+double Presolve::getObjectiveOffset() {
+    return this->offset;
+}
+
+/**
+ * @desc Retorna o número de restrições do problema original
+ *
+ * @returns long long
+ */
+long long Presolve::getOriginalRows() {
+    return this->numberOfRows;
+}
+
+/**
+ * @desc Retorna o número de variáveis do problema original
+ *
+ * @returns long long
+ */
+long long Presolve::getOriginalColumns() {
+    return this->numberOfVariables;
+}
+
+/**
+ * @desc Retorna o número de restrições do problema reduzido
+ *
+ * @returns long long
+ */
+long long Presolve::getReducedRows() {
+    return this->reduced->getConstraints().rows();
+}
+
+/**
+ * @desc Retorna o número de variáveis do problema reduzido
+ *
+ * @returns long long
+ */
+long long Presolve::getReducedColumns() {
+    return this->reduced->getObjectiveFunction().rows();
+}
+
+/**
+ * @desc Retorna quantas vezes limites de variáveis foram apertados
+ *
+ * @returns long long
+ */
+long long Presolve::getTightenedBounds() {
+    return this->tightenedBounds;
+}
+
+/**
+ * @desc Retorna quantos coeficientes foram apertados (contando as linhas normalizadas pelo mdc)
+ *
+ * @returns long long
+ */
+long long Presolve::getTightenedCoefficients() {
+    return this->tightenedCoefficients;
+}
@@ -0,0 +1,395 @@
+#include "../headers/PrimalHeuristics.h"
+#include <Eigen>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ * @param int mode Pode ser: SIMPLEX_MINIMIZE, SIMPLEX_MAXIMIZE
+ * @param int engine método de resolução dos PLs da feasibility pump: TABLEAU_ENGINE, REVISED_ENGINE
+ * @param unsigned int seed semente do arredondamento aleatório e das perturbações
+ * @param Limits *limits orçamento da resolução, também respeitado pelas heurísticas (NULL sem limites)
+ */
+PrimalHeuristics::PrimalHeuristics(Problem *ilp, int mode, int engine, unsigned int seed, Limits *limits) {
+    this->ilp = ilp;
+    this->mode = mode;
+    this->engine = engine;
+    this->limits = limits;
+    this->numberOfVariables = ilp->getObjectiveFunction().rows();
+    this->generator.seed(seed);
+    this->foundSolution = false;
+    this->optimum = 0;
+}
+
+/**
+ * @desc Arredondamento simples (para o inteiro mais próximo) seguido de arredondamentos
+ * @desc aleatórios, em que cada variável inteira sobe com probabilidade igual à sua parte
+ * @desc fracionária; as contínuas ficam com o valor da relaxação
+ *
+ * @param const VectorXd &values solução da relaxação
+ * @param const VectorXd &lower limites inferiores do nó
+ * @param const VectorXd &upper limites superiores do nó
+ * @returns bool true se encontrou uma solução viável
+ */
+bool PrimalHeuristics::rounding(const VectorXd &values, const VectorXd &lower, const VectorXd &upper) {
+    uniform_real_distribution<double> distribution(0, 1);
+    VectorXd rounded;
+    double fraction;
+
+    this->start(0);
+
+    this->submit(this->roundValues(values, lower, upper));
+
+    for(int trial = 0; trial < ROUNDING_TRIALS; trial++) {
+        rounded = values;
+        for(long long i = 0; i < this->numberOfVariables; i++) {
+            if(!this->ilp->isInteger(i)) {
+                continue;
+            }
+            fraction = values(i) - floor(values(i));
+            rounded(i) = (distribution(this->generator) < fraction) ? ceil(values(i)) : floor(values(i));
+        }
+        this->submit(this->roundValues(rounded, lower, upper));
+    }
+
+    return this->foundSolution;
+}
+
+/**
+ * @desc Mergulho: fixa uma variável fracionária por vez e reotimiza com o Simplex dual até a
+ * @desc relaxação ficar inteira. Sem incumbente é o mergulho fracionário (a variável mais próxima
+ * @desc de um inteiro vai para esse inteiro); com incumbente é o mergulho guiado (a variável mais
+ * @desc próxima do valor no incumbente vai na direção dele). Se um lado fica inviável, tenta o outro.
+ *
+ * @param LPSolver *solver relaxação resolvida do nó (não é alterada)
+ * @param const VectorXd &lower limites inferiores do nó
+ * @param const VectorXd &upper limites superiores do nó
+ * @param const VectorXd &incumbent melhor solução conhecida (vazia se não houver)
+ * @param double cutoff valor do incumbente: o mergulho para quando a relaxação não o supera
+ * @returns bool true se encontrou uma solução viável
+ */
+bool PrimalHeuristics::diving(LPSolver *solver, const VectorXd &lower, const VectorXd &upper, const VectorXd &incumbent, double cutoff) {
+    bool guided = (incumbent.rows() == this->numberOfVariables);
+    VectorXd values, diveLower = lower, diveUpper = upper;
+    LPSolver *dive = solver->clone(), *previous;
+    double fraction, score, bestScore;
+    long long variable;
+    bool up = false;
+
+    this->start(DIVING_TIME_LIMIT);
+
+    while(dive->hasSolution() && this->isBetter(dive->getOptimum(), cutoff) && !this->isTimeOver()) {
+        values = dive->getSolution();
+        if(this->isIntegral(values)) {
+            this->submit(this->roundValues(values, lower, upper));
+            break;
+        }
+
+        variable = -1;
+        bestScore = 0;
+        for(long long i = 0; i < this->numberOfVariables; i++) {
+            fraction = values(i) - floor(values(i));
+            if(!this->ilp->isInteger(i) || fraction < HEURISTIC_TOLERANCE || fraction > 1 - HEURISTIC_TOLERANCE) {
+                continue;
+            }
+            score = guided ? fabs(values(i) - incumbent(i)) : fmin(fraction, 1 - fraction);
+            if(variable == -1 || score < bestScore) {
+                variable = i;
+                bestScore = score;
+                up = guided ? incumbent(i) > values(i) : fraction >= 0.5;
+            }
+        }
+
+        previous = dive->clone();
+        if(up) {
+            dive->setBounds(variable, ceil(values(variable)), diveUpper(variable));
+        } else {
+            dive->setBounds(variable, diveLower(variable), floor(values(variable)));
+        }
+        dive->reoptimize();
+
+        //lado inviável: volta um nível e fixa a variável no outro lado
+        if(!dive->hasSolution()) {
+            delete dive;
+            dive = previous;
+            previous = NULL;
+            up = !up;
+            if(up) {
+                dive->setBounds(variable, ceil(values(variable)), diveUpper(variable));
+            } else {
+                dive->setBounds(variable, diveLower(variable), floor(values(variable)));
+            }
+            dive->reoptimize();
+        }
+        delete previous;
+
+        if(up) {
+            diveLower(variable) = ceil(values(variable));
+        } else {
+            diveUpper(variable) = floor(values(variable));
+        }
+    }
+
+    delete dive;
+    return this->foundSolution;
+}
+
+/**
+ * @desc Feasibility pump: alterna entre arredondar a solução da relaxação e resolver o PL que
+ * @desc minimiza a distância ao ponto arredondado, até os dois coincidirem. Em ciclos, as
+ * @desc variáveis inteiras mais distantes da relaxação são arredondadas para o outro lado.
+ *
+ * @param LPSolver *solver relaxação resolvida do nó
+ * @param const VectorXd &lower limites inferiores do nó
+ * @param const VectorXd &upper limites superiores do nó
+ * @returns bool true se encontrou uma solução viável
+ */
+bool PrimalHeuristics::feasibilityPump(LPSolver *solver, const VectorXd &lower, const VectorXd &upper) {
+    VectorXd values = solver->getSolution(), rounded, last;
+    vector<long long> order(this->numberOfVariables);
+    LPSolver *distance;
+    bool cycle;
+
+    this->start(PUMP_TIME_LIMIT);
+
+    for(int iteration = 0; iteration < PUMP_ITERATIONS && !this->isTimeOver(); iteration++) {
+        rounded = this->roundValues(values, lower, upper);
+
+        //ciclo: as variáveis inteiras voltaram ao arredondamento anterior
+        cycle = last.rows() > 0;
+        for(long long i = 0; i < this->numberOfVariables && cycle; i++) {
+            cycle = !this->ilp->isInteger(i) || fabs(rounded(i) - last(i)) < HEURISTIC_TOLERANCE;
+        }
+        if(cycle) {
+            for(long long i = 0; i < this->numberOfVariables; i++) {
+                order[i] = i;
+            }
+            sort(order.begin(), order.end(), [&values, &rounded](long long first, long long second) {
+                return fabs(values(first) - rounded(first)) > fabs(values(second) - rounded(second));
+            });
+            uniform_int_distribution<int> flips(PUMP_FLIPS / 2, PUMP_FLIPS);
+            for(long long k = 0, total = flips(this->generator); k < total && k < this->numberOfVariables; k++) {
+                long long i = order[k];
+                if(!this->ilp->isInteger(i)) {
+                    continue;
+                }
+                rounded(i) += (values(i) > rounded(i)) ? 1 : -1;
+                rounded(i) = fmin(fmax(rounded(i), lower(i)), upper(i));
+            }
+        }
+        last = rounded;
+
+        if(this->submit(rounded)) {
+            break;
+        }
+
+        distance = this->solveDistance(rounded, values, lower, upper);
+        if(!distance->hasSolution()) {
+            delete distance;
+            break;
+        }
+        values = distance->getSolution();
+        delete distance;
+
+        if(this->isIntegral(values) && this->submit(this->roundValues(values, lower, upper))) {
+            break;
+        }
+    }
+
+    return this->foundSolution;
+}
+
+/**
+ * @desc Resolve o PL da feasibility pump: as restrições e limites do nó com a função objetivo que
+ * @desc aproxima a distância L1 até o ponto arredondado (cada variável inteira é puxada na direção dele)
+ *
+ * @param const VectorXd &rounded ponto arredondado
+ * @param const VectorXd &values solução anterior da relaxação
+ * @param const VectorXd &lower limites inferiores do nó
+ * @param const VectorXd &upper limites superiores do nó
+ * @returns LPSolver* resolvido (deve ser liberado por quem chama)
+ */
+LPSolver* PrimalHeuristics::solveDistance(const VectorXd &rounded, const VectorXd &values, const VectorXd &lower, const VectorXd &upper) {
+    VectorXd objectiveFunction = VectorXd::Zero(this->numberOfVariables);
+    Problem *problem;
+    LPSolver *solver;
+
+    for(long long i = 0; i < this->numberOfVariables; i++) {
+        if(!this->ilp->isInteger(i)) {
+            continue;
+        }
+        if(rounded(i) < values(i) || rounded(i) <= lower(i)) {
+            objectiveFunction(i) = 1;
+        } else if(rounded(i) > values(i) || rounded(i) >= upper(i)) {
+            objectiveFunction(i) = -1;
+        }
+    }
+
+    problem = new Problem(objectiveFunction, this->ilp->getConstraints(), this->ilp->getRelations());
+    for(long long i = 0; i < this->numberOfVariables; i++) {
+        problem->setBounds(i, lower(i), upper(i));
+        problem->setVariableType(i, this->ilp->getVariableType(i));
+    }
+    solver = LPSolver::create(this->engine, SIMPLEX_MINIMIZE, problem, this->limits);
+    delete problem;
+    return solver;
+}
+
+/**
+ * @desc Reinicia a melhor solução da chamada e o prazo da heurística
+ *
+ * @param long long timeLimit tempo máximo em milissegundos
+ * @returns void
+ */
+void PrimalHeuristics::start(long long timeLimit) {
+    this->foundSolution = false;
+    this->deadline = chrono::steady_clock::now() + chrono::milliseconds(timeLimit);
+}
+
+/**
+ * @desc Verifica se o prazo da heurística ou o orçamento da resolução acabou
+ *
+ * @returns bool
+ */
+bool PrimalHeuristics::isTimeOver() {
+    return chrono::steady_clock::now() >= this->deadline || (this->limits != NULL && this->limits->isReached());
+}
+
+/**
+ * @desc Verifica se um ponto satisfaz as restrições e os limites do problema original
+ *
+ * @param const VectorXd &values
+ * @returns bool
+ */
+bool PrimalHeuristics::isFeasible(const VectorXd &values) {
+    const SparseMatrixXd &constraints = this->ilp->getConstraints();
+    VectorXd relations = this->ilp->getRelations();
+    VectorXd lower = this->ilp->getLowerBounds();
+    VectorXd upper = this->ilp->getUpperBounds();
+    double activity, rhs;
+
+    for(long long i = 0; i < this->numberOfVariables; i++) {
+        if(values(i) < lower(i) - HEURISTIC_TOLERANCE || values(i) > upper(i) + HEURISTIC_TOLERANCE) {
+            return false;
+        }
+    }
+
+    for(long long i = 0; i < constraints.rows(); i++) {
+        activity = 0;
+        rhs = 0;
+        for(SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if(it.col() < this->numberOfVariables) {
+                activity += it.value() * values(it.col());
+            } else {
+                rhs = it.value();
+            }
+        }
+        //relações: 0 (<=), 1 (>=), 2 (=)
+        if((relations(i) != 1 && activity > rhs + HEURISTIC_TOLERANCE)
+            || (relations(i) != 0 && activity < rhs - HEURISTIC_TOLERANCE)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Verifica se todas as variáveis inteiras estão a menos da tolerância de um inteiro
+ *
+ * @param const VectorXd &values
+ * @returns bool
+ */
+bool PrimalHeuristics::isIntegral(const VectorXd &values) {
+    for(long long i = 0; i < this->numberOfVariables; i++) {
+        if(this->ilp->isInteger(i) && fabs(values(i) - round(values(i))) > HEURISTIC_TOLERANCE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Compara dois valores da função objetivo segundo o modo
+ *
+ * @param double value
+ * @param double reference
+ * @returns bool true se value é estritamente melhor
+ */
+bool PrimalHeuristics::isBetter(double value, double reference) {
+    return (this->mode == SIMPLEX_MAXIMIZE) ? value > reference : value < reference;
+}
+
+/**
+ * @desc Arredonda cada variável inteira para o inteiro mais próximo dentro dos limites do nó
+ * @desc (as contínuas só são levadas para dentro dos limites)
+ *
+ * @param const VectorXd &values
+ * @param const VectorXd &lower
+ * @param const VectorXd &upper
+ * @returns VectorXd
+ */
+VectorXd PrimalHeuristics::roundValues(const VectorXd &values, const VectorXd &lower, const VectorXd &upper) {
+    VectorXd rounded(this->numberOfVariables);
+
+    for(long long i = 0; i < this->numberOfVariables; i++) {
+        if(!this->ilp->isInteger(i)) {
+            rounded(i) = fmin(fmax(values(i), lower(i)), upper(i));
+            continue;
+        }
+        rounded(i) = fmin(fmax(round(values(i)), ceil(lower(i) - HEURISTIC_TOLERANCE)), floor(upper(i) + HEURISTIC_TOLERANCE));
+    }
+    return rounded;
+}
+
+/**
+ * @desc Guarda o ponto como melhor solução da chamada se ele for viável e melhor que o atual
+ *
+ * @param const VectorXd &values ponto inteiro
+ * @returns bool true se o ponto é viável
+ */
+bool PrimalHeuristics::submit(const VectorXd &values) {
+    double value;
+
+    if(!this->isFeasible(values)) {
+        return false;
+    }
+    value = this->ilp->getObjectiveFunction().dot(values);
+    if(!this->foundSolution || this->isBetter(value, this->optimum)) {
+        this->foundSolution = true;
+        this->optimum = value;
+        this->solution = values;
+    }
+    return true;
+}
+
+/**
+ * @desc Retorna true se a última heurística executada encontrou uma solução
+ *
+ * @returns bool
+ */
+bool PrimalHeuristics::hasSolution() {
+    return this->foundSolution;
+}
+
+/**
+ * @desc Retorna o valor da melhor solução encontrada pela última heurística executada
+ *
+ * @returns double
+ */
+double PrimalHeuristics::getOptimum() {
+    return this->optimum;
+}
+
+/**
+ * @desc Retorna a melhor solução encontrada pela última heurística executada
+ *
+ * @returns VectorXd
+ */
+VectorXd PrimalHeuristics::getSolution() {
+    return this->solution;
+}
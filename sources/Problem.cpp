@@ -1,26 +1,46 @@
 #include "../headers/Problem.h"
+#include <limits>
 
 using namespace Eigen;
+using namespace std;
 
 /**
  * @desc Construtor
  *
  * @param const VectorXd &objectiveFunction Os coeficientes da função objetivo.
  * @param const VectorXd &relations Os sinais de relação das restrições {0 -> <=; 1 -> >=; 2 -> =}.
- * @param const MatrixXd &constraints Matriz com todas as restrições.
+ * @param const SparseMatrixXd &constraints Matriz esparsa com todas as restrições (última coluna é o lado direito).
+ * @desc Os limites das variáveis começam em [0, infinito) e todas são inteiras
  */
-Problem::Problem(const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations) {
+Problem::Problem(const VectorXd &objectiveFunction, const SparseMatrixXd &constraints, const VectorXd &relations) {
     this->objectiveFunction = objectiveFunction;
     this->constraints = constraints;
     this->relations = relations;
+    this->lowerBounds = VectorXd::Zero(objectiveFunction.rows());
+    this->upperBounds = VectorXd::Constant(objectiveFunction.rows(), numeric_limits<double>::infinity());
+}
+
+/**
+ * @desc Construtor que assume a matriz de restrições (montada pelos leitores) sem copiá-la
+ *
+ * @param const VectorXd &objectiveFunction Os coeficientes da função objetivo.
+ * @param SparseMatrixXd &&constraints Matriz esparsa com todas as restrições (fica vazia).
+ * @param const VectorXd &relations Os sinais de relação das restrições {0 -> <=; 1 -> >=; 2 -> =}.
+ */
+Problem::Problem(const VectorXd &objectiveFunction, SparseMatrixXd &&constraints, const VectorXd &relations) {
+    this->objectiveFunction = objectiveFunction;
+    this->constraints.swap(constraints);
+    this->relations = relations;
+    this->lowerBounds = VectorXd::Zero(objectiveFunction.rows());
+    this->upperBounds = VectorXd::Constant(objectiveFunction.rows(), numeric_limits<double>::infinity());
 }
 
 /**
  * @desc Retorna as restrições do problema
  *
- * @returns MatrixXd
+ * @returns const SparseMatrixXd&
  */
-MatrixXd Problem::getConstraints() {
+const SparseMatrixXd& Problem::getConstraints() {
     return this->constraints;
 }
 
@@ -43,20 +63,151 @@ VectorXd Problem::getObjectiveFunction() {
 }
 
 /**
- * @desc Adiciona uma nova função de restrição e sua relação
+ * @desc Retorna os limites inferiores das variáveis
  *
- * @returns bool true se adicionou a restricao ou false caso a restrição já exista
+ * @returns VectorXd
  */
-bool Problem::addConstraint(VectorXd constraint, int relation) {
-    long long temp;
-    for(temp = 0; temp < this->constraints.rows(); temp++) {
-        if(((this->constraints.row(temp) - constraint.transpose()).norm() == 0) && this->relations(temp) == relation) {
-            return false;
+VectorXd Problem::getLowerBounds() {
+    return this->lowerBounds;
+}
+
+/**
+ * @desc Retorna os limites superiores das variáveis (infinito se não houver)
+ *
+ * @returns VectorXd
+ */
+VectorXd Problem::getUpperBounds() {
+    return this->upperBounds;
+}
+
+/**
+ * @desc Altera os limites de uma variável
+ *
+ * @param long long variable índice da variável
+ * @param double lower limite inferior
+ * @param double upper limite superior
+ * @returns void
+ */
+void Problem::setBounds(long long variable, double lower, double upper) {
+    this->lowerBounds(variable) = lower;
+    this->upperBounds(variable) = upper;
+}
+
+/**
+ * @desc Define os nomes das variáveis lidos do arquivo
+ *
+ * @param const vector<string> &variableNames um nome por coluna (vazio: x1..xn)
+ * @returns void
+ */
+void Problem::setVariableNames(const vector<string> &variableNames) {
+    this->variableNames = variableNames;
+}
+
+/**
+ * @desc Retorna os nomes das variáveis (vazio se o arquivo usava x1..xn)
+ *
+ * @returns const vector<string>&
+ */
+const vector<string>& Problem::getVariableNames() {
+    return this->variableNames;
+}
+
+/**
+ * @desc Retorna o nome de uma variável (x<índice> se o problema não tem nomes)
+ *
+ * @param long long variable
+ * @returns string
+ */
+string Problem::getVariableName(long long variable) {
+    if(this->variableNames.empty()) {
+        return "x" + to_string(variable + 1);
+    }
+    return this->variableNames[variable];
+}
+
+/**
+ * @desc Define a integralidade de uma variável. As binárias recebem os limites [0, 1]
+ * @desc implícitos (intersectados com os atuais), sem linhas extras na matriz.
+ *
+ * @param long long variable índice da variável
+ * @param int type CONTINUOUS_VARIABLE, GENERAL_VARIABLE ou BINARY_VARIABLE
+ * @returns void
+ */
+void Problem::setVariableType(long long variable, int type) {
+    if(this->variableTypes.empty()) {
+        if(type == GENERAL_VARIABLE) {
+            return;
+        }
+        this->variableTypes.assign(this->objectiveFunction.rows(), GENERAL_VARIABLE);
+    }
+    this->variableTypes[variable] = type;
+    if(type == BINARY_VARIABLE) {
+        this->lowerBounds(variable) = max(this->lowerBounds(variable), 0.0);
+        this->upperBounds(variable) = min(this->upperBounds(variable), 1.0);
+    }
+}
+
+/**
+ * @desc Retorna a integralidade de uma variável
+ *
+ * @param long long variable
+ * @returns int CONTINUOUS_VARIABLE, GENERAL_VARIABLE ou BINARY_VARIABLE
+ */
+int Problem::getVariableType(long long variable) {
+    if(this->variableTypes.empty()) {
+        return GENERAL_VARIABLE;
+    }
+    return this->variableTypes[variable];
+}
+
+/**
+ * @desc Verifica se a variável deve assumir valor inteiro
+ *
+ * @param long long variable
+ * @returns bool
+ */
+bool Problem::isInteger(long long variable) {
+    return this->variableTypes.empty() || this->variableTypes[variable] != CONTINUOUS_VARIABLE;
+}
+
+/**
+ * @desc Verifica se o problema é misto (tem alguma variável contínua)
+ *
+ * @returns bool
+ */
+bool Problem::hasContinuousVariables() {
+    for(size_t j = 0; j < this->variableTypes.size(); j++) {
+        if(this->variableTypes[j] == CONTINUOUS_VARIABLE) {
+            return true;
         }
     }
-    this->constraints.conservativeResize(this->constraints.rows()+1, this->constraints.cols());
-    this->constraints.row(this->constraints.rows()-1) = constraint;
-    this->relations.conservativeResize(this->relations.rows()+1);
-    this->relations(this->relations.rows()-1) = relation;
-    return true;
+    return false;
+}
+
+/**
+ * @desc Registra que as duas colunas são as partes x+ e x- de uma variável livre (x = x+ - x-)
+ *
+ * @param long long variable
+ * @param long long partner
+ * @returns void
+ */
+void Problem::setSplitPartner(long long variable, long long partner) {
+    if(this->splitPartners.empty()) {
+        this->splitPartners.assign(this->objectiveFunction.rows(), -1);
+    }
+    this->splitPartners[variable] = partner;
+    this->splitPartners[partner] = variable;
+}
+
+/**
+ * @desc Retorna a outra parte da variável livre dividida (-1 se a coluna não for uma parte)
+ *
+ * @param long long variable
+ * @returns long long
+ */
+long long Problem::getSplitPartner(long long variable) {
+    if(this->splitPartners.empty()) {
+        return -1;
+    }
+    return this->splitPartners[variable];
 }
@@ -0,0 +1,229 @@
+#include "../headers/Propagator.h"
+#include <Eigen>
+#include <cmath>
+#include <limits>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: guarda as restrições como intervalos e as linhas de cada coluna
+ *
+ * @param Problem *ilp problema cujas restrições são propagadas
+ */
+Propagator::Propagator(Problem *ilp) {
+    const SparseMatrixXd &constraints = ilp->getConstraints();
+    VectorXd relations = ilp->getRelations();
+    double infinity = numeric_limits<double>::infinity();
+    double rhs;
+
+    this->numberOfVariables = ilp->getObjectiveFunction().rows();
+    this->numberOfRows = constraints.rows();
+    this->rows.assign(this->numberOfRows, vector<pair<long long, double> >());
+    this->columns.assign(this->numberOfVariables, vector<long long>());
+    this->integers.resize(this->numberOfVariables);
+    for(long long j = 0; j < this->numberOfVariables; j++) {
+        this->integers[j] = ilp->isInteger(j);
+    }
+
+    for(long long i = 0; i < this->numberOfRows; i++) {
+        rhs = 0;
+        for(SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if(it.col() >= this->numberOfVariables) {
+                rhs = it.value();
+            } else if(it.value() != 0) {
+                this->rows[i].push_back(make_pair((long long) it.col(), it.value()));
+                this->columns[it.col()].push_back(i);
+            }
+        }
+        //relações: 0 (<=), 1 (>=), 2 (=)
+        this->rowLower.push_back(relations(i) == 0 ? -infinity : rhs);
+        this->rowUpper.push_back(relations(i) == 1 ? infinity : rhs);
+    }
+}
+
+/**
+ * @desc Propaga alterações de limites pelas restrições: a cada passada revisita apenas as
+ * @desc linhas das colunas alteradas na passada anterior, até não haver mudança ou atingir
+ * @desc PROPAGATION_PASSES.
+ *
+ * @param VectorXd &lower limites inferiores do nó (apertados no lugar)
+ * @param VectorXd &upper limites superiores do nó (apertados no lugar)
+ * @param const vector<long long> &changed colunas cujos limites mudaram desde a última propagação
+ * @param long long &tightened soma o número de limites apertados
+ * @returns bool false se os limites são inviáveis
+ */
+bool Propagator::propagate(VectorXd &lower, VectorXd &upper, const vector<long long> &changed, long long &tightened) {
+    vector<bool> marked(this->numberOfRows, false);
+    vector<long long> queue, columnsChanged = changed;
+
+    for(long long pass = 0; pass < PROPAGATION_PASSES && !columnsChanged.empty(); pass++) {
+        queue.clear();
+        for(size_t k = 0; k < columnsChanged.size(); k++) {
+            for(size_t i = 0; i < this->columns[columnsChanged[k]].size(); i++) {
+                if(!marked[this->columns[columnsChanged[k]][i]]) {
+                    marked[this->columns[columnsChanged[k]][i]] = true;
+                    queue.push_back(this->columns[columnsChanged[k]][i]);
+                }
+            }
+        }
+
+        columnsChanged.clear();
+        for(size_t i = 0; i < queue.size(); i++) {
+            marked[queue[i]] = false;
+            if(!this->propagateRow(queue[i], lower, upper, columnsChanged, tightened)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Propaga uma linha: verifica se a atividade mínima/máxima ainda cabe no intervalo e aperta
+ * @desc o limite de cada coluna pelo que sobra do intervalo quando as outras estão no extremo.
+ *
+ * @param long long row
+ * @param VectorXd &lower
+ * @param VectorXd &upper
+ * @param vector<long long> &changed recebe as colunas apertadas
+ * @param long long &tightened soma o número de limites apertados
+ * @returns bool false se a linha não pode ser satisfeita
+ */
+bool Propagator::propagateRow(long long row, VectorXd &lower, VectorXd &upper, vector<long long> &changed, long long &tightened) {
+    const vector<pair<long long, double> > &entries = this->rows[row];
+    double minimum = 0, maximum = 0, low, high, rest, coefficient;
+    long long minimumInfinite = 0, maximumInfinite = 0, column;
+    bool updated;
+
+    for(size_t k = 0; k < entries.size(); k++) {
+        column = entries[k].first;
+        coefficient = entries[k].second;
+        low = coefficient * ((coefficient > 0) ? lower(column) : upper(column));
+        high = coefficient * ((coefficient > 0) ? upper(column) : lower(column));
+        if(isinf(low)) {
+            minimumInfinite++;
+        } else {
+            minimum += low;
+        }
+        if(isinf(high)) {
+            maximumInfinite++;
+        } else {
+            maximum += high;
+        }
+    }
+
+    if(minimumInfinite == 0 && minimum > this->rowUpper[row] + PROPAGATION_TOLERANCE * fmax(1, fabs(this->rowUpper[row]))) {
+        return false;
+    }
+    if(maximumInfinite == 0 && maximum < this->rowLower[row] - PROPAGATION_TOLERANCE * fmax(1, fabs(this->rowLower[row]))) {
+        return false;
+    }
+
+    for(size_t k = 0; k < entries.size(); k++) {
+        column = entries[k].first;
+        coefficient = entries[k].second;
+        low = coefficient * ((coefficient > 0) ? lower(column) : upper(column));
+        high = coefficient * ((coefficient > 0) ? upper(column) : lower(column));
+        updated = false;
+
+        //a.x_k <= rowUpper - atividade mínima das outras colunas
+        if(!isinf(this->rowUpper[row]) && minimumInfinite <= 1 && (minimumInfinite == 0 || isinf(low))) {
+            rest = isinf(low) ? minimum : minimum - low;
+            if(coefficient > 0) {
+                updated |= this->tightenUpper(column, (this->rowUpper[row] - rest) / coefficient, lower, upper);
+            } else {
+                updated |= this->tightenLower(column, (this->rowUpper[row] - rest) / coefficient, lower, upper);
+            }
+        }
+
+        //a.x_k >= rowLower - atividade máxima das outras colunas
+        if(!isinf(this->rowLower[row]) && maximumInfinite <= 1 && (maximumInfinite == 0 || isinf(high))) {
+            rest = isinf(high) ? maximum : maximum - high;
+            if(coefficient > 0) {
+                updated |= this->tightenLower(column, (this->rowLower[row] - rest) / coefficient, lower, upper);
+            } else {
+                updated |= this->tightenUpper(column, (this->rowLower[row] - rest) / coefficient, lower, upper);
+            }
+        }
+
+        if(updated) {
+            if(lower(column) > upper(column)) {
+                return false;
+            }
+            changed.push_back(column);
+            tightened++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Aumenta o limite inferior de uma coluna, se o novo valor for melhor
+ *
+ * @param long long column
+ * @param double value novo limite inferior (arredondado para cima se a coluna é inteira)
+ * @param VectorXd &lower
+ * @param VectorXd &upper
+ * @returns bool true se o limite mudou
+ */
+bool Propagator::tightenLower(long long column, double value, VectorXd &lower, VectorXd &upper) {
+    double range;
+
+    if(this->isInteger(column)) {
+        value = ceil(value - PROPAGATION_INTEGER_TOLERANCE);
+        if(value <= lower(column)) {
+            return false;
+        }
+    } else {
+        range = upper(column) - lower(column);
+        if(isinf(value) || value <= lower(column) + PROPAGATION_MIN_IMPROVEMENT * fmax(1, isinf(range) ? fabs(value) : range)) {
+            return false;
+        }
+        //erro numérico: o limite novo passa do outro limite por muito pouco
+        if(value > upper(column) && value <= upper(column) + PROPAGATION_INTEGER_TOLERANCE) {
+            value = upper(column);
+        }
+    }
+    lower(column) = value;
+    return true;
+}
+
+/**
+ * @desc Diminui o limite superior de uma coluna, se o novo valor for melhor
+ *
+ * @param long long column
+ * @param double value novo limite superior (arredondado para baixo se a coluna é inteira)
+ * @param VectorXd &lower
+ * @param VectorXd &upper
+ * @returns bool true se o limite mudou
+ */
+bool Propagator::tightenUpper(long long column, double value, VectorXd &lower, VectorXd &upper) {
+    double range;
+
+    if(this->isInteger(column)) {
+        value = floor(value + PROPAGATION_INTEGER_TOLERANCE);
+        if(value >= upper(column)) {
+            return false;
+        }
+    } else {
+        range = upper(column) - lower(column);
+        if(isinf(value) || value >= upper(column) - PROPAGATION_MIN_IMPROVEMENT * fmax(1, isinf(range) ? fabs(value) : range)) {
+            return false;
+        }
+        if(value < lower(column) && value >= lower(column) - PROPAGATION_INTEGER_TOLERANCE) {
+            value = lower(column);
+        }
+    }
+    upper(column) = value;
+    return true;
+}
+
+/**
+ * @desc Verifica se a coluna é inteira
+ *
+ * @param long long column
+ * @returns bool
+ */
+bool Propagator::isInteger(long long column) {
+    return this->integers[column];
+}
@@ -0,0 +1,914 @@
+#include <Eigen>
+#include <cmath>
+#include <limits>
+#include "../headers/RevisedSimplex.h"
+#include "../headers/Exception.h"
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor padrão
+ *
+ * @param int mode Pode ser: SIMPLEX_MINIMIZE, SIMPLEX_MAXIMIZE
+ * @param Problem *problem problema com função objetivo, restrições, relações e limites das variáveis.
+ * @param Limits *limits orçamento consultado a cada pivô (NULL sem limites)
+ * @returns RevisedSimplex
+ */
+RevisedSimplex::RevisedSimplex(int mode, Problem *problem, Limits *limits) {
+    this->limits = limits;
+    this->status = LP_INFEASIBLE;
+    this->foundSolution = false;
+    this->optimum = 0;
+    this->iterations = 0;
+    this->objectiveFunction = problem->getObjectiveFunction();
+    this->numberOfVariables = this->objectiveFunction.rows();
+
+    this->isValidEntry(mode, problem);
+
+    if ((problem->getLowerBounds().array() > problem->getUpperBounds().array()).any()) {
+        return; // Sem solução
+    }
+
+    int numberOfArtificials = this->buildColumns(problem);
+
+    //o Simplex revisado sempre minimiza
+    if (mode == SIMPLEX_MAXIMIZE) {
+        this->cost.head(this->numberOfVariables) = -this->objectiveFunction;
+    }
+
+    this->refactor();
+
+    /*
+        Primeira fase Simplex
+    */
+    if (numberOfArtificials > 0) {
+        if (!this->simplexSolver(FIRST_PHASE) && this->status == LP_INTERRUPTED) {
+            return; // Orçamento esgotado
+        }
+
+        //caso a soma das variáveis artificiais não seja 0, não existe solução para a PLI
+        double infeasibility = 0;
+        for (long long i = 0; i < this->numberOfRows; i++) {
+            if (this->isArtificial(this->basis[i])) {
+                infeasibility += this->basicValues(i);
+            }
+        }
+        if (this->adjustPrecision(infeasibility) != 0) {
+            return; // Sem solução
+        }
+
+        this->removeArtificials();
+    }
+
+    /*
+        Segunda fase Simplex
+    */
+    if (!this->simplexSolver(SECOND_PHASE)) {
+        return; // Sem solução
+    }
+
+    this->refactor();
+    this->searchSolution();
+}
+
+/**
+ * @desc Construtor de cópia: copia a base e refatora (a fatoração LU não é copiada)
+ *
+ * @param const RevisedSimplex &other
+ * @returns RevisedSimplex
+ */
+RevisedSimplex::RevisedSimplex(const RevisedSimplex &other) : LPSolver(other) {
+    this->columns = other.columns;
+    this->cost = other.cost;
+    this->rhs = other.rhs;
+    this->objectiveFunction = other.objectiveFunction;
+    this->lowerBounds = other.lowerBounds;
+    this->upperBounds = other.upperBounds;
+    this->atUpper = other.atUpper;
+    this->basis = other.basis;
+    this->position = other.position;
+    this->numberOfVariables = other.numberOfVariables;
+    this->numberOfRows = other.numberOfRows;
+    this->firstArtificial = other.firstArtificial;
+    this->lastArtificial = other.lastArtificial;
+    this->iterations = other.iterations;
+    this->foundSolution = other.foundSolution;
+    this->optimum = other.optimum;
+    this->solution = other.solution;
+
+    this->refactor();
+}
+
+/**
+ * @desc Retorna true se a solução foi encontrada.
+ * @desc Retorna false caso contrário.
+ *
+ * @returns boolean
+ */
+bool RevisedSimplex::hasSolution() {
+    return this->foundSolution;
+}
+
+/**
+ * @desc Retorna o valor ótimo da função objetivo maximizado ou minimizado
+ *
+ * @returns double
+ */
+double RevisedSimplex::getOptimum() {
+    return this->optimum;
+}
+
+/**
+ * @desc Retorna o valor das variáveis para a solução encontrada.
+ *
+ * @returns VectorXd vetor contendo a solução do problema
+ */
+VectorXd RevisedSimplex::getSolution() {
+    return this->solution;
+}
+
+/**
+ * @desc Retorna o número de pivôs realizados
+ *
+ * @returns long long
+ */
+long long RevisedSimplex::getIterations() {
+    return this->iterations;
+}
+
+/**
+ * @desc Cria uma cópia da base atual, usada como ponto de partida (warm start) de outro problema.
+ *
+ * @returns LPSolver*
+ */
+LPSolver* RevisedSimplex::clone() {
+    return new RevisedSimplex(*this);
+}
+
+/**
+ * @desc Adiciona restrições, cada uma com uma nova variável de folga básica. As linhas de uma
+ * @desc rodada de cortes entram juntas: a matriz é remontada e a base refatorada uma só vez.
+ * @desc As folgas podem ficar negativas, a viabilidade é restaurada em reoptimize.
+ *
+ * @param const vector<SparseVector<double> > &constraints coeficientes de cada restrição (último é o lado direito)
+ * @param int relation relação das restrições {0 -> <=; 1 -> >=}
+ * @returns void
+ */
+void RevisedSimplex::addConstraints(const vector<SparseVector<double> > &constraints, int relation) {
+    vector<Triplet<double> > triplets;
+    long long rows = this->numberOfRows, cols = this->columns.cols();
+    long long added = constraints.size(), row, slack, nonZeros = 0;
+
+    if (added == 0) {
+        return;
+    }
+    for (long long k = 0; k < added; k++) {
+        nonZeros += constraints[k].nonZeros();
+    }
+    triplets.reserve(this->columns.nonZeros() + nonZeros + added);
+    for (long long j = 0; j < cols; j++) {
+        for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+            triplets.push_back(Triplet<double>(it.row(), j, it.value()));
+        }
+    }
+
+    this->rhs.conservativeResize(rows + added);
+    this->cost.conservativeResize(cols + added);
+    this->lowerBounds.conservativeResize(cols + added);
+    this->upperBounds.conservativeResize(cols + added);
+    for (long long k = 0; k < added; k++) {
+        row = rows + k;
+        slack = cols + k;
+        this->rhs(row) = 0;
+        for (SparseVector<double>::InnerIterator it(constraints[k]); it; ++it) {
+            if (it.index() < this->numberOfVariables) {
+                triplets.push_back(Triplet<double>(row, it.index(), it.value()));
+            } else {
+                this->rhs(row) = it.value();
+            }
+        }
+        triplets.push_back(Triplet<double>(row, slack, (relation == 1) ? -1 : 1));
+
+        this->cost(slack) = 0;
+        this->lowerBounds(slack) = 0;
+        this->upperBounds(slack) = numeric_limits<double>::infinity();
+        this->atUpper.push_back(false);
+        this->basis.push_back(slack);
+        this->position.push_back(row);
+    }
+
+    this->columns.resize(rows + added, cols + added);
+    this->columns.setFromTriplets(triplets.begin(), triplets.end());
+    this->numberOfRows += added;
+
+    this->refactor();
+}
+
+/**
+ * @desc Altera os limites de uma variável. Uma variável não básica acompanha o seu limite
+ * @desc e os valores básicos são atualizados; uma básica pode sair dos limites (ver reoptimize).
+ *
+ * @param long long variable índice da variável
+ * @param double lower novo limite inferior (finito)
+ * @param double upper novo limite superior (pode ser infinito)
+ * @returns void
+ */
+void RevisedSimplex::setBounds(long long variable, double lower, double upper) {
+    double oldValue = this->getNonbasicValue(variable);
+
+    this->lowerBounds(variable) = lower;
+    this->upperBounds(variable) = upper;
+    if (isinf(upper)) {
+        this->atUpper[variable] = false;
+    }
+
+    if (this->position[variable] == -1 && this->getNonbasicValue(variable) != oldValue) {
+        this->basicValues -= this->ftran(VectorXd(this->columns.col(variable))) * (this->getNonbasicValue(variable) - oldValue);
+    }
+}
+
+/**
+ * @desc Reotimiza a base após a inclusão de restrições ou mudança de limites com o Simplex dual.
+ *
+ * @returns bool true se o problema continua com solução
+ */
+bool RevisedSimplex::reoptimize() {
+    this->foundSolution = false;
+    this->status = LP_INFEASIBLE;
+
+    if ((this->lowerBounds.array() > this->upperBounds.array()).any()) {
+        return false; // Sem solução
+    }
+
+    if (!this->dualSimplexSolver()) {
+        return false; // Sem solução
+    }
+
+    if (!this->simplexSolver(SECOND_PHASE)) {
+        return false; // Sem solução
+    }
+
+    this->refactor();
+    this->searchSolution();
+    return true;
+}
+
+/**
+ * @desc Executa no máximo iterationLimit pivôs do Simplex dual após mudanças de limites.
+ * @desc Como o Simplex dual só piora o valor da função objetivo, o valor atual
+ * @desc (getObjectiveValue) é um limite dual válido mesmo que a reotimização não termine.
+ *
+ * @param long long iterationLimit número máximo de pivôs
+ * @returns bool false se o problema foi provado inviável ou o orçamento se esgotou (ver getStatus)
+ */
+bool RevisedSimplex::dualReoptimize(long long iterationLimit) {
+    this->foundSolution = false;
+    this->status = LP_INFEASIBLE;
+
+    if ((this->lowerBounds.array() > this->upperBounds.array()).any()) {
+        return false; // Sem solução
+    }
+
+    return this->dualSimplexSolver(iterationLimit);
+}
+
+/**
+ * @desc Retorna o valor atual da função objetivo na base (mesmo sem solução ótima)
+ *
+ * @returns double
+ */
+double RevisedSimplex::getObjectiveValue() {
+    double value = 0;
+
+    for (long long j = 0; j < this->numberOfVariables; j++) {
+        if (this->position[j] != -1) {
+            value += this->objectiveFunction(j) * this->basicValues(this->position[j]);
+        } else {
+            value += this->objectiveFunction(j) * this->getNonbasicValue(j);
+        }
+    }
+    return value;
+}
+
+/**
+ * @desc Retorna os custos reduzidos das variáveis na base atual: variação da função objetivo
+ * @desc por unidade de aumento da variável (c_j - y.A_j, com y = c_B * B^-1 na função objetivo
+ * @desc do problema, sem a troca de sinal da maximização)
+ *
+ * @returns VectorXd
+ */
+VectorXd RevisedSimplex::getReducedCosts() {
+    VectorXd basicCost = VectorXd::Zero(this->numberOfRows);
+    VectorXd reducedCosts = this->objectiveFunction;
+    VectorXd dual;
+
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        if (this->basis[i] < this->numberOfVariables) {
+            basicCost(i) = this->objectiveFunction(this->basis[i]);
+        }
+    }
+    dual = this->btran(basicCost);
+
+    for (long long j = 0; j < this->numberOfVariables; j++) {
+        for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+            reducedCosts(j) -= dual(it.row()) * it.value();
+        }
+    }
+    return reducedCosts;
+}
+
+/**
+ * @desc Simplex dual: parte de uma base dual viável (custos reduzidos com o sinal correto
+ * @desc para o limite de cada variável não básica) com alguma variável básica fora dos
+ * @desc seus limites e restaura a viabilidade, levando a variável que sai ao limite violado.
+ * @desc A cada iteração calcula apenas a linha pivotal (e_r^T * B^-1 * A) e os custos reduzidos.
+ *
+ * @param long long iterationLimit número máximo de pivôs (-1 sem limite)
+ * @returns bool Retorna true se uma solucao foi encontrada (ou o limite foi atingido), false caso o problema seja inviável ou o orçamento se esgote.
+ */
+bool RevisedSimplex::dualSimplexSolver(long long iterationLimit) {
+    long long pivotRow, enteringColumn, leaving, pivots = 0;
+    double value, reducedCost, ratio, minRatio, infeasibility, target;
+    bool toUpper;
+    VectorXd basicCost(this->numberOfRows);
+    VectorXd unit, row, dual, column;
+
+    while (iterationLimit < 0 || pivots < iterationLimit) {
+
+        /*
+            Busca a linha pivotal (maior violação de limite de uma variável básica)
+        */
+        pivotRow = -1;
+        infeasibility = FEASIBILITY_TOLERANCE;
+        toUpper = false;
+        for (long long i = 0; i < this->numberOfRows; i++) {
+            leaving = this->basis[i];
+            if (this->lowerBounds(leaving) - this->basicValues(i) > infeasibility) {
+                pivotRow = i;
+                infeasibility = this->lowerBounds(leaving) - this->basicValues(i);
+                toUpper = false;
+            }
+            if (this->basicValues(i) - this->upperBounds(leaving) > infeasibility) {
+                pivotRow = i;
+                infeasibility = this->basicValues(i) - this->upperBounds(leaving);
+                toUpper = true;
+            }
+        }
+
+        if (pivotRow == -1) {
+            break;
+        }
+
+        unit = VectorXd::Zero(this->numberOfRows);
+        unit(pivotRow) = 1;
+        row = this->btran(unit);
+
+        for (long long i = 0; i < this->numberOfRows; i++) {
+            basicCost(i) = this->cost(this->basis[i]);
+        }
+        dual = this->btran(basicCost);
+
+        /*
+            Busca a coluna pivotal (teste da razão dual): a variável que entra precisa mover
+            a variável básica na direção do limite violado sem sair do seu próprio limite
+        */
+        enteringColumn = -1;
+        minRatio = 0;
+        for (long long j = 0; j < this->columns.cols(); j++) {
+            if (this->position[j] != -1 || this->isArtificial(j) || this->lowerBounds(j) == this->upperBounds(j)) {
+                continue;
+            }
+
+            value = 0;
+            reducedCost = this->cost(j);
+            for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+                value += row(it.row()) * it.value();
+                reducedCost -= dual(it.row()) * it.value();
+            }
+
+            //com a variável no limite superior o sentido do movimento se inverte
+            if (toUpper != this->atUpper[j]) {
+                value = -value;
+            }
+            if (value >= -PIVOT_TOLERANCE) {
+                continue;
+            }
+
+            ratio = fmax(this->atUpper[j] ? -reducedCost : reducedCost, 0) / -value;
+            if (enteringColumn == -1 || ratio < minRatio) {
+                enteringColumn = j;
+                minRatio = ratio;
+            }
+        }
+
+        if (enteringColumn == -1) {
+            //sem solução
+            return false;
+        }
+
+        if (this->isInterrupted()) {
+            return false;
+        }
+
+        column = this->ftran(VectorXd(this->columns.col(enteringColumn)));
+        leaving = this->basis[pivotRow];
+        target = toUpper ? this->upperBounds(leaving) : this->lowerBounds(leaving);
+        this->pivot(pivotRow, enteringColumn, column, (this->basicValues(pivotRow) - target) / column(pivotRow), toUpper);
+        pivots++;
+    }
+    return true;
+}
+
+/**
+ * @desc Verifica se a coluna é de uma variável artificial da primeira fase
+ *
+ * @param long long column
+ * @returns bool
+ */
+bool RevisedSimplex::isArtificial(long long column) {
+    return column >= this->firstArtificial && column < this->lastArtificial;
+}
+
+/**
+ * @desc Executa o Simplex revisado a partir da base atual.
+ * @desc A cada iteração calcula apenas as variáveis duais (BTRAN), os custos reduzidos
+ * @desc das colunas não básicas e a coluna de entrada (FTRAN).
+ *
+ * @param int phase (Se e a primeira ou segunda fase do metodo simplex).
+ * @returns bool Retorna true se uma solucao foi encontrada, false caso seja ilimitado.
+ */
+bool RevisedSimplex::simplexSolver(int phase) {
+    long long enteringColumn, pivotRow;
+    int degenerate = 0;
+    bool bland, toUpper;
+    double direction, step;
+    VectorXd phaseCost = this->getPhaseCost(phase);
+    VectorXd basicCost(this->numberOfRows);
+    VectorXd dual, column;
+
+    while (true) {
+        for (long long i = 0; i < this->numberOfRows; i++) {
+            basicCost(i) = phaseCost(this->basis[i]);
+        }
+        dual = this->btran(basicCost);
+
+        //em caso de degeneração prolongada aplica Bland Rule para evitar ciclos
+        bland = degenerate > DEGENERATE_LIMIT;
+
+        /*
+            Busca a coluna pivotal
+        */
+        enteringColumn = this->findEnteringColumn(dual, phaseCost, phase, bland);
+        if (enteringColumn == -1) {
+            //nenhum custo reduzido negativo, a solução é ótima
+            break;
+        }
+
+        column = this->ftran(VectorXd(this->columns.col(enteringColumn)));
+
+        //variável no limite inferior aumenta, no limite superior diminui
+        direction = this->atUpper[enteringColumn] ? -1 : 1;
+
+        /*
+            Busca a linha pivotal
+        */
+        pivotRow = this->findPivot(column, direction,
+            this->upperBounds(enteringColumn) - this->lowerBounds(enteringColumn), bland, step, toUpper);
+        if (pivotRow == -1) {
+            //sem solução (ilimitado)
+            if (phase == SECOND_PHASE) {
+                this->status = LP_UNBOUNDED;
+            }
+            return false;
+        }
+
+        if (this->isInterrupted()) {
+            return false;
+        }
+
+        if (step < FEASIBILITY_TOLERANCE) {
+            degenerate++;
+        } else {
+            degenerate = 0;
+        }
+
+        if (pivotRow == BOUND_FLIP) {
+            //a variável que entra vai direto para o outro limite, sem troca de base
+            this->basicValues -= column * (direction * step);
+            this->atUpper[enteringColumn] = !this->atUpper[enteringColumn];
+            this->iterations++;
+            continue;
+        }
+
+        this->pivot(pivotRow, enteringColumn, column, direction * step, toUpper);
+    }
+    return true;
+}
+
+/**
+ * @desc Calcula os custos reduzidos das colunas não básicas e escolhe a coluna de entrada.
+ * @desc Usa a regra de Dantzig (maior melhora por unidade) ou Bland (primeiro índice).
+ * @desc Uma variável no limite superior melhora a solução com custo reduzido positivo.
+ *
+ * @param const VectorXd &dual variáveis duais da base atual
+ * @param const VectorXd &phaseCost custos da fase atual
+ * @param int phase indica a fase do metodo simplex
+ * @param bool bland habilita Bland Rule
+ * @returns long long Retorna o indice da coluna ou -1 se a base é ótima.
+ */
+long long RevisedSimplex::findEnteringColumn(const VectorXd &dual, const VectorXd &phaseCost, int phase, bool bland) {
+    long long enteringColumn = -1;
+    double reducedCost, minReducedCost = -OPTIMALITY_TOLERANCE;
+
+    for (long long j = 0; j < this->columns.cols(); j++) {
+        //na segunda fase as variáveis artificiais não podem voltar para a base
+        if (this->position[j] != -1 || (phase == SECOND_PHASE && this->isArtificial(j))) {
+            continue;
+        }
+
+        //variável fixa não pode se mover
+        if (this->lowerBounds(j) == this->upperBounds(j)) {
+            continue;
+        }
+
+        reducedCost = phaseCost(j);
+        for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+            reducedCost -= dual(it.row()) * it.value();
+        }
+        if (this->atUpper[j]) {
+            reducedCost = -reducedCost;
+        }
+
+        if (reducedCost < minReducedCost) {
+            enteringColumn = j;
+            minReducedCost = reducedCost;
+            if (bland) {
+                break;
+            }
+        }
+    }
+    return enteringColumn;
+}
+
+/**
+ * @desc Teste da razão com limites: a variável básica pode sair pelo limite inferior ou
+ * @desc superior, e a variável que entra pode apenas trocar de limite (BOUND_FLIP).
+ *
+ * @param const VectorXd &column coluna de entrada (B^-1 * a)
+ * @param double direction 1 se a variável que entra aumenta, -1 se diminui
+ * @param double range amplitude (limite superior - limite inferior) da variável que entra
+ * @param bool bland habilita Bland Rule
+ * @param double &step retorna o passo da variável que entra
+ * @param bool &toUpper retorna true se a variável que sai vai para o limite superior
+ * @returns long long Retorna o indice da linha pivotal, BOUND_FLIP ou -1 se não achou.
+ */
+long long RevisedSimplex::findPivot(const VectorXd &column, double direction, double range, bool bland, double &step, bool &toUpper) {
+    long long minIndex = -1;
+    double minRatio = 0;
+    double ratio, value;
+    bool upper;
+
+    toUpper = false;
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        value = direction * column(i);
+        if (value > PIVOT_TOLERANCE) {
+            //a variável básica diminui até o limite inferior
+            ratio = fmax(this->basicValues(i) - this->lowerBounds(this->basis[i]), 0) / value;
+            upper = false;
+        } else if (value < -PIVOT_TOLERANCE && !isinf(this->upperBounds(this->basis[i]))) {
+            //a variável básica aumenta até o limite superior
+            ratio = fmax(this->upperBounds(this->basis[i]) - this->basicValues(i), 0) / -value;
+            upper = true;
+        } else {
+            continue;
+        }
+
+        if (minIndex == -1 || ratio < minRatio - PIVOT_TOLERANCE) {
+            minIndex = i;
+            minRatio = ratio;
+            toUpper = upper;
+        } else if (ratio < minRatio + PIVOT_TOLERANCE) {
+            //empate: Bland escolhe o menor índice, senão o maior pivô (mais estável)
+            if (bland ? this->basis[i] < this->basis[minIndex] : fabs(column(i)) > fabs(column(minIndex))) {
+                minIndex = i;
+                minRatio = fmin(ratio, minRatio);
+                toUpper = upper;
+            }
+        }
+    }
+
+    //a variável que entra atinge o outro limite antes de qualquer básica
+    if (!isinf(range) && (minIndex == -1 || range <= minRatio)) {
+        step = range;
+        toUpper = false;
+        return BOUND_FLIP;
+    }
+    step = minRatio;
+    return minIndex;
+}
+
+/**
+ * @desc Operação com o pivô: atualiza os valores básicos e a base,
+ * @desc guardando a matriz eta correspondente (forma produto da inversa)
+ *
+ * @param long long pivotRow linha pivotal
+ * @param long long enteringColumn coluna que entra na base
+ * @param const VectorXd &column coluna de entrada transformada (B^-1 * a)
+ * @param double delta variação da variável que entra
+ * @param bool leavingAtUpper true se a variável que sai fica no limite superior
+ * @returns void
+ */
+void RevisedSimplex::pivot(long long pivotRow, long long enteringColumn, const VectorXd &column, double delta, bool leavingAtUpper) {
+    EtaMatrix eta;
+
+    this->basicValues -= column * delta;
+    this->basicValues(pivotRow) = this->getNonbasicValue(enteringColumn) + delta;
+
+    this->atUpper[this->basis[pivotRow]] = leavingAtUpper;
+    this->atUpper[enteringColumn] = false;
+    this->position[this->basis[pivotRow]] = -1;
+    this->basis[pivotRow] = enteringColumn;
+    this->position[enteringColumn] = pivotRow;
+
+    eta.row = pivotRow;
+    eta.pivot = column(pivotRow);
+    eta.column.resize(this->numberOfRows);
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        if (i != pivotRow && column(i) != 0) {
+            eta.column.insert(i) = column(i);
+        }
+    }
+    this->etas.push_back(eta);
+
+    this->iterations++;
+
+    if (this->etas.size() >= REFACTOR_FREQUENCY) {
+        this->refactor();
+    }
+}
+
+/**
+ * @desc Retira da base as variáveis artificiais que terminaram a primeira fase com valor 0.
+ * @desc Linhas em que nenhuma coluna pode substituir a artificial são redundantes e ficam como estão;
+ * @desc todas as artificiais ficam fixas em 0 na segunda fase.
+ *
+ * @returns void
+ */
+void RevisedSimplex::removeArtificials() {
+    long long enteringColumn;
+    double value, maxValue;
+    VectorXd unit, row;
+
+    for (long long r = 0; r < this->numberOfRows; r++) {
+        if (!this->isArtificial(this->basis[r])) {
+            continue;
+        }
+
+        //linha r de B^-1 * A, calculada apenas para as colunas não básicas
+        unit = VectorXd::Zero(this->numberOfRows);
+        unit(r) = 1;
+        row = this->btran(unit);
+
+        enteringColumn = -1;
+        maxValue = FEASIBILITY_TOLERANCE;
+        for (long long j = 0; j < this->columns.cols(); j++) {
+            if (this->position[j] != -1 || this->isArtificial(j)) {
+                continue;
+            }
+            value = 0;
+            for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+                value += row(it.row()) * it.value();
+            }
+            if (fabs(value) > maxValue) {
+                maxValue = fabs(value);
+                enteringColumn = j;
+            }
+        }
+
+        if (enteringColumn != -1) {
+            VectorXd column = this->ftran(VectorXd(this->columns.col(enteringColumn)));
+            this->pivot(r, enteringColumn, column, this->basicValues(r) / column(r), false);
+        }
+    }
+
+    //uma artificial que continua básica não pode voltar a crescer
+    for (long long j = this->firstArtificial; j < this->lastArtificial; j++) {
+        this->upperBounds(j) = 0;
+    }
+}
+
+/**
+ * @desc Retorna o valor de uma variável não básica (o limite em que ela está)
+ *
+ * @param long long column
+ * @returns double
+ */
+double RevisedSimplex::getNonbasicValue(long long column) {
+    return this->atUpper[column] ? this->upperBounds(column) : this->lowerBounds(column);
+}
+
+/**
+ * @desc Refatora a base atual (LU esparsa), descarta as matrizes eta
+ * @desc e recalcula os valores das variáveis básicas: x_B = B^-1 * (b - N * x_N)
+ *
+ * @throw Exception caso a base seja singular
+ * @returns void
+ */
+void RevisedSimplex::refactor() {
+    SparseMatrix<double> basisMatrix(this->numberOfRows, this->numberOfRows);
+    vector<Triplet<double> > triplets;
+
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        for (SparseMatrix<double>::InnerIterator it(this->columns, this->basis[i]); it; ++it) {
+            triplets.push_back(Triplet<double>(it.row(), i, it.value()));
+        }
+    }
+    basisMatrix.setFromTriplets(triplets.begin(), triplets.end());
+
+    this->lu.analyzePattern(basisMatrix);
+    this->lu.factorize(basisMatrix);
+    if (this->lu.info() != Success) {
+        throw(new Exception("RevisedSimplex: base singular!"));
+    }
+
+    VectorXd residual = this->rhs;
+    double value;
+    for (long long j = 0; j < this->columns.cols(); j++) {
+        if (this->position[j] != -1) {
+            continue;
+        }
+        value = this->getNonbasicValue(j);
+        if (value != 0) {
+            for (SparseMatrix<double>::InnerIterator it(this->columns, j); it; ++it) {
+                residual(it.row()) -= it.value() * value;
+            }
+        }
+    }
+
+    this->etas.clear();
+    this->basicValues = this->ftran(residual);
+}
+
+/**
+ * @desc Resolve B * x = column usando a fatoração LU e as matrizes eta
+ *
+ * @param const VectorXd &column
+ * @returns VectorXd
+ */
+VectorXd RevisedSimplex::ftran(const VectorXd &column) {
+    VectorXd result = this->lu.solve(column);
+    double value;
+
+    for (size_t k = 0; k < this->etas.size(); k++) {
+        const EtaMatrix &eta = this->etas[k];
+        value = result(eta.row) / eta.pivot;
+        for (SparseVector<double>::InnerIterator it(eta.column); it; ++it) {
+            result(it.index()) -= it.value() * value;
+        }
+        result(eta.row) = value;
+    }
+    return result;
+}
+
+/**
+ * @desc Resolve y^T * B = row usando as matrizes eta (em ordem inversa) e a fatoração LU
+ *
+ * @param const VectorXd &row
+ * @returns VectorXd
+ */
+VectorXd RevisedSimplex::btran(const VectorXd &row) {
+    VectorXd result = row;
+    double value;
+
+    for (long long k = (long long) this->etas.size() - 1; k >= 0; k--) {
+        const EtaMatrix &eta = this->etas[k];
+        value = result(eta.row);
+        for (SparseVector<double>::InnerIterator it(eta.column); it; ++it) {
+            value -= result(it.index()) * it.value();
+        }
+        result(eta.row) = value / eta.pivot;
+    }
+    return this->lu.transpose().solve(result);
+}
+
+/**
+ * @desc Retorna os custos da fase: soma das artificiais na primeira fase e a função objetivo na segunda
+ *
+ * @param int phase indica a fase do metodo simplex
+ * @returns VectorXd
+ */
+VectorXd RevisedSimplex::getPhaseCost(int phase) {
+    if (phase == SECOND_PHASE) {
+        return this->cost;
+    }
+
+    VectorXd phaseCost = VectorXd::Zero(this->columns.cols());
+    phaseCost.segment(this->firstArtificial, this->lastArtificial - this->firstArtificial).setOnes();
+    return phaseCost;
+}
+
+/**
+ * @desc Monta a matriz esparsa de colunas [A | folgas | artificiais] e a base inicial.
+ * @desc Com as variáveis nos limites inferiores, a folga da linha é básica quando fica
+ * @desc não negativa; senão a linha recebe uma artificial com o sinal do resíduo.
+ *
+ * @param Problem *problem problema a ser resolvido
+ * @returns int número de variáveis artificiais
+ */
+int RevisedSimplex::buildColumns(Problem *problem) {
+    const SparseMatrixXd &constraints = problem->getConstraints();
+    VectorXd relations = problem->getRelations();
+    VectorXd lower = problem->getLowerBounds();
+    vector<Triplet<double> > triplets;
+    long long numberOfSlacks = 0, slack, artificial, numberOfColumns;
+    int numberOfArtificials = 0;
+    VectorXd residual;
+
+    this->numberOfRows = constraints.rows();
+
+    this->rhs = VectorXd::Zero(this->numberOfRows);
+    residual = VectorXd::Zero(this->numberOfRows);
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        for (SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if (it.col() < this->numberOfVariables) {
+                triplets.push_back(Triplet<double>(i, it.col(), it.value()));
+                residual(i) -= it.value() * lower(it.col());
+            } else {
+                this->rhs(i) = it.value();
+            }
+        }
+        residual(i) += this->rhs(i);
+
+        if (relations(i) != 2) {
+            numberOfSlacks++;
+        }
+        if ((relations(i) == 0 && residual(i) < 0) || (relations(i) == 1 && residual(i) > 0) || relations(i) == 2) {
+            numberOfArtificials++;
+        }
+    }
+
+    this->firstArtificial = this->numberOfVariables + numberOfSlacks;
+    this->lastArtificial = this->firstArtificial + numberOfArtificials;
+    numberOfColumns = this->lastArtificial;
+    this->basis.resize(this->numberOfRows);
+    this->position.assign(numberOfColumns, -1);
+    this->atUpper.assign(numberOfColumns, false);
+
+    this->lowerBounds = VectorXd::Zero(numberOfColumns);
+    this->upperBounds = VectorXd::Constant(numberOfColumns, numeric_limits<double>::infinity());
+    this->lowerBounds.head(this->numberOfVariables) = lower;
+    this->upperBounds.head(this->numberOfVariables) = problem->getUpperBounds();
+
+    slack = this->numberOfVariables;
+    artificial = this->firstArtificial;
+    for (long long i = 0; i < this->numberOfRows; i++) {
+        if (relations(i) == 0 && residual(i) >= 0) {
+            triplets.push_back(Triplet<double>(i, slack, 1));
+            this->basis[i] = slack++;
+        } else if (relations(i) == 1 && residual(i) <= 0) {
+            triplets.push_back(Triplet<double>(i, slack, -1));
+            this->basis[i] = slack++;
+        } else {
+            if (relations(i) != 2) {
+                triplets.push_back(Triplet<double>(i, slack++, (relations(i) == 0) ? 1 : -1));
+            }
+            triplets.push_back(Triplet<double>(i, artificial, (residual(i) < 0) ? -1 : 1));
+            this->basis[i] = artificial++;
+        }
+        this->position[this->basis[i]] = i;
+    }
+
+    this->columns.resize(this->numberOfRows, numberOfColumns);
+    this->columns.setFromTriplets(triplets.begin(), triplets.end());
+
+    this->cost = VectorXd::Zero(numberOfColumns);
+    this->cost.head(this->numberOfVariables) = this->objectiveFunction;
+
+    return numberOfArtificials;
+}
+
+/**
+ * @desc Busca a solução a partir dos valores básicos
+ *
+ * @returns void
+ */
+void RevisedSimplex::searchSolution() {
+    VectorXd values = VectorXd::Zero(this->numberOfVariables);
+
+    this->solution.resize(this->numberOfVariables);
+
+    for (long long j = 0; j < this->numberOfVariables; j++) {
+        if (this->position[j] != -1) {
+            // Variavel basica
+            values(j) = this->basicValues(this->position[j]);
+        } else {
+            // Variavel nao basica (em um dos limites)
+            values(j) = this->getNonbasicValue(j);
+        }
+        this->solution(j) = this->adjustPrecision(values(j));
+    }
+
+    this->foundSolution = true;
+    this->status = LP_OPTIMAL;
+    this->optimum = this->adjustPrecision(this->objectiveFunction.dot(values));
+}
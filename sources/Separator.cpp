@@ -0,0 +1,228 @@
+#include "../headers/Separator.h"
+#include "../headers/GomorySeparator.h"
+#include "../headers/MirSeparator.h"
+#include "../headers/CoverSeparator.h"
+#include "../headers/CliqueSeparator.h"
+#include <Eigen>
+#include <chrono>
+#include <cmath>
+
+using namespace Eigen;
+
+/**
+ * @desc Construtor: guarda as restrições do problema no formato a.x <= b
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ * @param string name nome da família de cortes
+ */
+Separator::Separator(Problem *ilp, string name) {
+    const SparseMatrixXd &constraints = ilp->getConstraints();
+    VectorXd relations = ilp->getRelations();
+    SparseVector<double> row;
+    double rhs;
+
+    this->ilp = ilp;
+    this->name = name;
+    this->numberOfVariables = ilp->getObjectiveFunction().rows();
+    this->lowerBounds = ilp->getLowerBounds();
+    this->upperBounds = ilp->getUpperBounds();
+    this->foundCuts = 0;
+    this->appliedCuts = 0;
+    this->boundImprovement = 0;
+    this->time = 0;
+
+    for(long long i = 0; i < constraints.rows(); i++) {
+        row = SparseVector<double>(this->numberOfVariables);
+        rhs = 0;
+        for(SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if(it.col() < this->numberOfVariables) {
+                row.insert(it.col()) = it.value();
+            } else {
+                rhs = it.value();
+            }
+        }
+        //relações: 0 (<=), 1 (>=), 2 (=)
+        if(relations(i) != 1) {
+            this->rows.push_back(row);
+            this->rowsRhs.push_back(rhs);
+        }
+        if(relations(i) != 0) {
+            this->rows.push_back(-row);
+            this->rowsRhs.push_back(-rhs);
+        }
+    }
+}
+
+/**
+ * @desc Cria um separador de cada família de cortes
+ *
+ * @param Problem *ilp problema de Programação Linear Inteira
+ * @returns vector<Separator*> Gomory, MIR, cobertura e clique
+ */
+vector<Separator*> Separator::create(Problem *ilp) {
+    vector<Separator*> separators;
+
+    separators.push_back(new GomorySeparator(ilp));
+    separators.push_back(new MirSeparator(ilp));
+    separators.push_back(new CoverSeparator(ilp));
+    separators.push_back(new CliqueSeparator(ilp));
+    return separators;
+}
+
+/**
+ * @desc Retorna true se os cortes da família dependem dos limites da relaxação em que foram
+ * @desc gerados (no branch-and-cut valem apenas na subárvore do nó). Por padrão os cortes
+ * @desc usam só as restrições e os limites do problema e valem na árvore toda.
+ *
+ * @returns bool
+ */
+bool Separator::isLocal() {
+    return false;
+}
+
+/**
+ * @desc Executa o separador no ponto, medindo o tempo e contando os cortes encontrados
+ *
+ * @param LPSolver *solver relaxação resolvida
+ * @param const VectorXd &point solução da relaxação
+ * @param vector<SparseVector<double> > &cuts recebe os cortes violados (a.x >= b)
+ * @returns void
+ */
+void Separator::run(LPSolver *solver, const VectorXd &point, vector<SparseVector<double> > &cuts) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    size_t before = cuts.size();
+
+    this->separate(solver, point, cuts);
+
+    this->foundCuts += cuts.size() - before;
+    this->time += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @desc Monta um corte a.x <= b no formato do pool (-a.x >= -b, último é o lado direito)
+ *
+ * @param const VectorXd &coefficients coeficientes a
+ * @param double rhs lado direito b
+ * @returns SparseVector<double>
+ */
+SparseVector<double> Separator::makeCut(const VectorXd &coefficients, double rhs) {
+    VectorXd cut(this->numberOfVariables + 1);
+
+    cut.head(this->numberOfVariables) = -coefficients;
+    cut(this->numberOfVariables) = -rhs;
+    return cut.sparseView();
+}
+
+/**
+ * @desc Escreve a linha como mochila nas variáveis binárias: y = x (peso a) ou y = 1 - x
+ * @desc (peso -a); as variáveis não binárias ficam na sua menor contribuição ao lado esquerdo.
+ *
+ * @param long long row índice da linha (a.x <= b)
+ * @param vector<long long> &variables recebe as variáveis binárias da mochila
+ * @param vector<double> &weights recebe os pesos (positivos)
+ * @param vector<bool> &complemented recebe true se o item é 1 - x
+ * @param double &capacity recebe a capacidade
+ * @returns bool false se a linha não tem mochila com pelo menos dois itens
+ */
+bool Separator::getKnapsack(long long row, vector<long long> &variables, vector<double> &weights, vector<bool> &complemented, double &capacity) {
+    long long j;
+
+    variables.clear();
+    weights.clear();
+    complemented.clear();
+    capacity = this->rowsRhs[row];
+
+    for(SparseVector<double>::InnerIterator it(this->rows[row]); it; ++it) {
+        j = it.index();
+        if(this->isBinary(j)) {
+            variables.push_back(j);
+            complemented.push_back(it.value() < 0);
+            weights.push_back(fabs(it.value()));
+            if(it.value() < 0) {
+                capacity -= it.value();
+            }
+        } else if(it.value() > 0) {
+            capacity -= it.value() * this->lowerBounds(j);
+        } else if(!isinf(this->upperBounds(j))) {
+            capacity -= it.value() * this->upperBounds(j);
+        } else {
+            return false;
+        }
+    }
+    return variables.size() >= 2 && capacity >= 0;
+}
+
+/**
+ * @desc Verifica se a variável é binária (inteira com limites 0 e 1)
+ *
+ * @param long long variable
+ * @returns bool
+ */
+bool Separator::isBinary(long long variable) {
+    return this->ilp->isInteger(variable) && this->lowerBounds(variable) == 0 && this->upperBounds(variable) == 1;
+}
+
+/**
+ * @desc Registra cortes da família inseridos no PL
+ *
+ * @param long long cuts
+ * @returns void
+ */
+void Separator::registerApplied(long long cuts) {
+    this->appliedCuts += cuts;
+}
+
+/**
+ * @desc Registra a parte da melhora do limite atribuída à família
+ *
+ * @param double improvement
+ * @returns void
+ */
+void Separator::registerImprovement(double improvement) {
+    this->boundImprovement += improvement;
+}
+
+/**
+ * @desc Retorna o nome da família de cortes
+ *
+ * @returns string
+ */
+string Separator::getName() {
+    return this->name;
+}
+
+/**
+ * @desc Retorna o número de cortes violados encontrados
+ *
+ * @returns long long
+ */
+long long Separator::getFoundCuts() {
+    return this->foundCuts;
+}
+
+/**
+ * @desc Retorna o número de cortes inseridos no PL
+ *
+ * @returns long long
+ */
+long long Separator::getAppliedCuts() {
+    return this->appliedCuts;
+}
+
+/**
+ * @desc Retorna a melhora do limite atribuída à família
+ *
+ * @returns double
+ */
+double Separator::getBoundImprovement() {
+    return this->boundImprovement;
+}
+
+/**
+ * @desc Retorna o tempo gasto na separação (ms)
+ *
+ * @returns double
+ */
+double Separator::getTime() {
+    return this->time;
+}
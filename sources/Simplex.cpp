@@ -1,94 +1,67 @@
 #include <Eigen>
-#include <unordered_map>
+#include <cmath>
+#include <limits>
 #include "../headers/Simplex.h"
 #include "../headers/Exception.h"
 
 using namespace Eigen;
 
+/*
+    Variáveis limitadas: cada variável x_j do tableau é escrita em relação ao seu limite,
+    x_j = l_j + v_j, ou x_j = u_j - v_j quando está complementada (no limite superior).
+    Assim 0 <= v_j <= u_j - l_j e os limites nunca viram linhas do tableau.
+*/
+
 /**
  * @desc Construtor padrão
  *
  * @param int mode Pode ser: SIMPLEX_MINIMIZE, SIMPLEX_MAXIMIZE
- * @param const VectorXd &objectiveFunction Os coeficientes da função objetivo.
- * @param const VectorXd &relations Os sinais de relacao das restrições {0 -> <=; 1 -> >=; 2 -> =}.
- * @param const MatrixXd &constraints Matriz com todas as restricoes.
+ * @param Problem *problem problema com função objetivo, restrições, relações e limites das variáveis.
+ * @param Limits *limits orçamento consultado a cada pivô (NULL sem limites)
  * @returns Simplex
  */
-Simplex::Simplex(int mode, const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations) {
+Simplex::Simplex(int mode, Problem *problem, Limits *limits) {
+    this->limits = limits;
+    this->status = LP_INFEASIBLE;
+    this->mode = mode;
     this->foundSolution = false;
     this->optimum = 0;
-    this->numberOfVariables = objectiveFunction.rows();
+    this->iterations = 0;
+    this->numberOfVariables = problem->getObjectiveFunction().rows();
+    this->lowerBounds = problem->getLowerBounds();
+    this->upperBounds = problem->getUpperBounds();
+    this->complemented.assign(this->numberOfVariables, false);
+    this->integers.resize(this->numberOfVariables);
+    for (long long j = 0; j < this->numberOfVariables; j++) {
+        this->integers[j] = problem->isInteger(j);
+    }
 
-    this->isValidEntry(mode, objectiveFunction, constraints, relations);
+    this->isValidEntry(mode, problem);
+
+    if ((this->lowerBounds.array() > this->upperBounds.array()).any()) {
+        return; // Sem solução
+    }
 
-    int numberOfArtificials = this->buildTableau(mode, objectiveFunction, constraints, relations);
+    int numberOfArtificials = this->buildTableau(problem);
 
     /*
         Primeira fase Simplex
     */
     if(numberOfArtificials > 0) {
         //caso a minimizacao não seja 0, não existe solução para a PLI
-        this->simplexSolver(this->numberOfVariables, SIMPLEX_MINIMIZE, FIRST_PHASE);
+        if (!this->simplexSolver(SIMPLEX_MINIMIZE, FIRST_PHASE) && this->status == LP_INTERRUPTED) {
+            return; // Orçamento esgotado
+        }
         if (this->adjustPrecision(this->tableau(0, this->tableau.cols() - 1)) != 0) {
             return; // Sem solução
         }
-        //remove a primeira linha criada para cancelar as variáveis artificiais
-        this->removeRow(0);
-        //remove as colunas das variáveis artificiais
-        for(long long  i = 0; i < numberOfArtificials; i++) {
-            this->removeColumn(this->tableau.cols() - 2);
-        }
+        this->removeArtificials(numberOfArtificials);
     }
 
     /*
         Segunda fase Simplex
     */
-    if (!this->simplexSolver(this->numberOfVariables, mode, SECOND_PHASE)) {
-        return; // Sem solução
-    }
-
-    this->searchSolution();
-
-}
-
-/**
- * @desc Construtor utilizado pelo método de Planos de Corte
- *
- * @param int mode Pode ser: SIMPLEX_MINIMIZE, SIMPLEX_MAXIMIZE
- * @param const VectorXd &objectiveFunction Os coeficientes da função objetivo.
- * @param const VectorXd &relations Os sinais de relacao das restrições {0 -> <=; 1 -> >=; 2 -> =}.
- * @param const MatrixXd &constraints Matriz com todas as restricoes.
- * @param const MatrixXd &cuts cortes gerados pelo método planos de corte
- * @returns Simplex
-*/
-Simplex::Simplex(int mode, const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations, const MatrixXd &cuts) {
-    this->foundSolution = false;
-    this->optimum = 0;
-    this->numberOfVariables = objectiveFunction.rows();
-
-    this->isValidEntry(mode, objectiveFunction, constraints, relations);
-
-    int numberOfArtificials = this->buildTableauWithCuts(mode, objectiveFunction, constraints, relations, cuts);
-
-    /*
-        Primeira fase Simplex (os cortes sempre terão variáveis artificiais)
-    */
-    //caso a minimizacao não seja 0, não existe solução para a PLI
-    this->simplexSolver(this->numberOfVariables, SIMPLEX_MINIMIZE, FIRST_PHASE);
-    if (this->adjustPrecision(this->tableau(0, this->tableau.cols() - 1)) != 0) {
-        return; // Sem solução
-    }
-    //remove a primeira linha criada para cancelar as variáveis artificiais
-    this->removeRow(0);
-    //remove as colunas das variáveis artificiais
-    for(long long  i = 0; i < numberOfArtificials; i++) {
-        this->removeColumn(this->tableau.cols() - 2);
-    }
-
-    /*
-     Segunda fase Simplex
-    */
-    if (!this->simplexSolver(this->numberOfVariables, mode, SECOND_PHASE)) {
+    if (!this->simplexSolver(mode, SECOND_PHASE)) {
         return; // Sem solução
     }
 
@@ -133,177 +106,673 @@ MatrixXd Simplex::getTableau() {
     return this->tableau;
 }
 
+/**
+ * @desc Cria uma cópia do tableau atual, usada como ponto de partida (warm start) de outro problema.
+ *
+ * @returns LPSolver*
+ */
+LPSolver* Simplex::clone() {
+    return new Simplex(*this);
+}
+
+/**
+ * @desc Retorna o número de pivôs realizados (inclusive trocas de limite).
+ *
+ * @returns long long
+ */
+long long Simplex::getIterations() {
+    return this->iterations;
+}
+
+/**
+ * @desc Adiciona uma restrição ao tableau ótimo, escrita em função das variáveis não básicas,
+ * @desc com uma nova variável de folga básica. O lado direito pode ficar negativo (ver reoptimize).
+ *
+ * @param const SparseVector<double> &constraint coeficientes da restrição (último é o lado direito)
+ * @param int relation relação da restrição {0 -> <=; 1 -> >=}
+ * @returns void
+ */
+void Simplex::addConstraint(const SparseVector<double> &constraint, int relation) {
+    long long rows = this->tableau.rows();
+    long long cols = this->tableau.cols();
+    double sign = (relation == 1) ? -1 : 1;
+    long long j;
+
+    //nova coluna de folga antes do lado direito e nova linha no final
+    this->tableau.conservativeResize(rows + 1, cols + 1);
+    this->tableau.col(cols) = this->tableau.col(cols - 1);
+    this->tableau.col(cols - 1).setZero();
+    this->tableau.row(rows).setZero();
+
+    //reescreve a restrição em função das variáveis deslocadas para os seus limites
+    for (SparseVector<double>::InnerIterator it(constraint); it; ++it) {
+        j = it.index();
+        if (j < this->numberOfVariables) {
+            if (this->complemented[j]) {
+                this->tableau(rows, j) = -sign * it.value();
+                this->tableau(rows, cols) -= sign * it.value() * this->upperBounds(j);
+            } else {
+                this->tableau(rows, j) = sign * it.value();
+                this->tableau(rows, cols) -= sign * it.value() * this->lowerBounds(j);
+            }
+        } else {
+            this->tableau(rows, cols) += sign * it.value();
+        }
+    }
+    this->tableau(rows, cols - 1) = 1;
+    this->addSlackDefinition(constraint, -sign, -1);
+
+    //elimina as variáveis básicas da nova linha
+    for (long long i = 1; i < rows; i++) {
+        j = this->basis[i];
+        if (this->tableau(rows, j) != 0) {
+            this->tableau.row(rows) -= this->tableau.row(i) * this->tableau(rows, j);
+            this->tableau(rows, j) = 0;
+        }
+    }
+    this->basis.push_back(cols - 1);
+}
+
+/**
+ * @desc Adiciona várias restrições (por exemplo, os cortes de uma rodada) ao tableau ótimo
+ *
+ * @param const vector<SparseVector<double> > &constraints coeficientes de cada restrição (último é o lado direito)
+ * @param int relation relação das restrições {0 -> <=; 1 -> >=}
+ * @returns void
+ */
+void Simplex::addConstraints(const vector<SparseVector<double> > &constraints, int relation) {
+    for (size_t k = 0; k < constraints.size(); k++) {
+        this->addConstraint(constraints[k], relation);
+    }
+}
+
+/**
+ * @desc Altera os limites de uma variável no tableau ótimo, deslocando o lado direito.
+ * @desc Variáveis básicas podem sair dos seus limites (ver reoptimize).
+ *
+ * @param long long variable índice da variável
+ * @param double lower novo limite inferior (finito)
+ * @param double upper novo limite superior (pode ser infinito)
+ * @returns void
+ */
+void Simplex::setBounds(long long variable, double lower, double upper) {
+    long long constantColumn = this->tableau.cols() - 1;
+    long long row = -1;
+    double shift;
+
+    for (long long i = 1; i < this->tableau.rows(); i++) {
+        if (this->basis[i] == variable) {
+            row = i;
+            break;
+        }
+    }
+
+    //sem limite superior a variável volta a ser escrita em relação ao limite inferior
+    if (this->complemented[variable] && isinf(upper)) {
+        if (row == -1) {
+            this->complementColumn(variable);
+        } else {
+            this->complementRow(row);
+        }
+    }
+
+    if (this->complemented[variable]) {
+        shift = this->upperBounds(variable) - upper;
+    } else {
+        shift = lower - this->lowerBounds(variable);
+    }
+
+    if (shift != 0) {
+        this->tableau.col(constantColumn) -= this->tableau.col(variable) * shift;
+    }
+
+    this->lowerBounds(variable) = lower;
+    this->upperBounds(variable) = upper;
+}
+
+/**
+ * @desc Reotimiza o tableau após a inclusão de restrições ou mudança de limites com o Simplex dual.
+ *
+ * @returns bool true se o problema continua com solução
+ */
+bool Simplex::reoptimize() {
+    this->foundSolution = false;
+    this->status = LP_INFEASIBLE;
+
+    if ((this->lowerBounds.array() > this->upperBounds.array()).any()) {
+        return false; // Sem solução
+    }
+
+    if (!this->dualSimplexSolver()) {
+        return false; // Sem solução
+    }
+
+    if (!this->simplexSolver(this->mode, SECOND_PHASE)) {
+        return false; // Sem solução
+    }
+
+    this->searchSolution();
+    return true;
+}
+
+/**
+ * @desc Executa no máximo iterationLimit pivôs do Simplex dual após mudanças de limites.
+ * @desc Como o Simplex dual só piora o valor da função objetivo, o valor atual
+ * @desc (getObjectiveValue) é um limite dual válido mesmo que a reotimização não termine.
+ *
+ * @param long long iterationLimit número máximo de pivôs
+ * @returns bool false se o problema foi provado inviável ou o orçamento se esgotou (ver getStatus)
+ */
+bool Simplex::dualReoptimize(long long iterationLimit) {
+    this->foundSolution = false;
+    this->status = LP_INFEASIBLE;
+
+    if ((this->lowerBounds.array() > this->upperBounds.array()).any()) {
+        return false; // Sem solução
+    }
+
+    return this->dualSimplexSolver(iterationLimit);
+}
+
+/**
+ * @desc Retorna o valor atual da função objetivo no tableau (mesmo sem solução ótima)
+ *
+ * @returns double
+ */
+double Simplex::getObjectiveValue() {
+    return this->tableau(0, this->tableau.cols() - 1);
+}
+
+/**
+ * @desc Retorna os custos reduzidos das variáveis no tableau atual: variação da função objetivo
+ * @desc por unidade de aumento da variável (a linha 0 guarda o custo com o sinal trocado e as
+ * @desc colunas complementadas medem a distância ao limite superior).
+ *
+ * @returns VectorXd
+ */
+VectorXd Simplex::getReducedCosts() {
+    VectorXd reducedCosts(this->numberOfVariables);
+
+    for (long long j = 0; j < this->numberOfVariables; j++) {
+        reducedCosts(j) = this->complemented[j] ? this->tableau(0, j) : -this->tableau(0, j);
+    }
+    return reducedCosts;
+}
+
+/**
+ * @desc Reescreve um corte (>=) gerado nas colunas do tableau atual em função das variáveis
+ * @desc originais: cada coluna não básica é substituída pela sua definição (variável deslocada
+ * @desc para o limite ou folga de uma restrição). O corte só vale com os limites atuais.
+ *
+ * @param const VectorXd &cut coeficientes nas colunas do tableau (último é o lado direito)
+ * @returns SparseVector<double> coeficientes nas variáveis originais (último é o lado direito)
+ */
+SparseVector<double> Simplex::getOriginalCut(const VectorXd &cut) {
+    long long constantColumn = cut.rows() - 1;
+    VectorXd original = VectorXd::Zero(this->numberOfVariables + 1);
+
+    original(this->numberOfVariables) = cut(constantColumn);
+    for (long long j = 0; j < constantColumn; j++) {
+        if (cut(j) == 0) {
+            continue;
+        }
+        if (j < this->numberOfVariables) {
+            //v = x - l ou v = u - x (complementada)
+            if (this->complemented[j]) {
+                original(j) -= cut(j);
+                original(this->numberOfVariables) -= cut(j) * this->upperBounds(j);
+            } else {
+                original(j) += cut(j);
+                original(this->numberOfVariables) += cut(j) * this->lowerBounds(j);
+            }
+        } else {
+            //folga = definição . [x; 1]
+            const SparseVector<double> &definition = this->slackDefinitions[j - this->numberOfVariables];
+            for (SparseVector<double>::InnerIterator it(definition); it; ++it) {
+                if (it.index() < this->numberOfVariables) {
+                    original(it.index()) += cut(j) * it.value();
+                } else {
+                    original(this->numberOfVariables) -= cut(j) * it.value();
+                }
+            }
+        }
+    }
+    return original.sparseView();
+}
+
+/**
+ * @desc Insere um corte (>=) nas variáveis originais no tableau ótimo, identificado por id
+ * @desc para poder ser removido depois (ver removeCut). A viabilidade é recuperada em reoptimize.
+ *
+ * @param const SparseVector<double> &cut coeficientes do corte (último é o lado direito)
+ * @param long long id identificador do corte
+ * @returns void
+ */
+void Simplex::addCut(const SparseVector<double> &cut, long long id) {
+    this->addConstraint(cut, 1);
+    this->slackIds.back() = id;
+}
+
+/**
+ * @desc Remove do tableau um corte inativo: com a folga básica, a linha e a coluna da folga
+ * @desc saem sem alterar as outras linhas e a base continua ótima.
+ *
+ * @param long long id identificador do corte
+ * @returns bool false se o corte não está no tableau ou está ativo (folga não básica)
+ */
+bool Simplex::removeCut(long long id) {
+    long long column = -1;
+
+    for (size_t k = 0; k < this->slackIds.size(); k++) {
+        if (this->slackIds[k] == id) {
+            column = this->numberOfVariables + k;
+            break;
+        }
+    }
+    if (column == -1) {
+        return false;
+    }
+
+    for (long long i = 1; i < this->tableau.rows(); i++) {
+        if (this->basis[i] == column) {
+            this->removeRow(i);
+            this->removeColumn(column);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @desc Verifica se a coluna do tableau só assume valores inteiros nas soluções inteiras:
+ * @desc variáveis inteiras com limite inteiro e folgas de restrições com coeficientes inteiros
+ * @desc só sobre variáveis inteiras
+ *
+ * @param long long column coluna do tableau
+ * @returns bool
+ */
+bool Simplex::isIntegerColumn(long long column) {
+    double bound;
+
+    if (column < this->numberOfVariables) {
+        bound = this->complemented[column] ? this->upperBounds(column) : this->lowerBounds(column);
+        return this->integers[column] && (isinf(bound) || fabs(bound - round(bound)) < INTEGER_COEFFICIENT_TOLERANCE);
+    }
+    const SparseVector<double> &definition = this->slackDefinitions[column - this->numberOfVariables];
+    for (SparseVector<double>::InnerIterator it(definition); it; ++it) {
+        if ((it.index() < this->numberOfVariables && !this->integers[it.index()])
+            || fabs(it.value() - round(it.value())) >= INTEGER_COEFFICIENT_TOLERANCE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @desc Guarda a definição da nova coluna de folga: folga = sign * (a.x - b)
+ *
+ * @param const SparseVector<double> &constraint coeficientes da restrição (último é o lado direito)
+ * @param double sign sinal da folga
+ * @param long long id identificador do corte (-1 para restrições)
+ * @returns void
+ */
+void Simplex::addSlackDefinition(const SparseVector<double> &constraint, double sign, long long id) {
+    SparseVector<double> definition = sign * constraint;
+
+    //o lado direito entra na definição com o sinal trocado
+    for (SparseVector<double>::InnerIterator it(definition); it; ++it) {
+        if (it.index() >= this->numberOfVariables) {
+            it.valueRef() = -it.value();
+        }
+    }
+    this->slackDefinitions.push_back(definition);
+    this->slackIds.push_back(id);
+}
+
 /**
  * @desc Busca na matriz tableau a solução.
  *
- * @param __int64 variableNum (O número de variáveis).
  * @param int mode (Se e para maximizar ou minimizar).
  * @param int phase (Se e a primeira ou segunda fase do metodo simplex).
  * @returns bool Retorna true se uma solucao foi encontrada, false caso não seja.
  */
-bool Simplex::simplexSolver(long long variableNum, int mode, int phase) {
-    MatrixXd::Index pivotColumn;
-    long long pivotRow, i;
-    double lastOptimum;
-    int repeatOptimum = 0;
-    unordered_map<long long, double> pivots;
+bool Simplex::simplexSolver(int mode, int phase) {
+    long long pivotColumn, pivotRow, j;
+    long long constantColumn = this->tableau.cols() - 1;
+    int degenerate = 0;
+    double value, best;
+    bool bland, toUpper;
 
     while (true) {
 
-        lastOptimum = this->tableau(0, this->tableau.cols()-1);
+        //Bland Rule após muitos pivôs degenerados seguidos, para evitar ciclagem
+        bland = degenerate > TABLEAU_DEGENERATE_LIMIT;
 
         /*
-            Busca a coluna pivotal
+            Busca a coluna pivotal: coeficiente mais negativo da linha 0 na maximização
+            e mais positivo na minimização (o primeiro candidato com Bland Rule)
         */
-        if (mode == SIMPLEX_MAXIMIZE) {
-            this->tableau.row(0).minCoeff(&pivotColumn);
-            if(this->adjustPrecision(this->tableau(0, pivotColumn)) >= 0) {
-                //se o menor valor for maior ou igual a zero então a solução foi encontrada
-                break;
+        pivotColumn = -1;
+        best = 0;
+        for (j = 0; j < constantColumn; j++) {
+            value = this->adjustPrecision(this->tableau(0, j));
+            if (mode == SIMPLEX_MAXIMIZE) {
+                value = -value;
             }
-        } else {
-            this->tableau.row(0).leftCols(this->tableau.cols()-1).maxCoeff(&pivotColumn);
-            if(this->adjustPrecision(this->tableau(0, pivotColumn)) <= 0) {
-                //se o maior valor for menor ou igual a zero então a solução foi encontrada
-                break;
+            if (value > best) {
+                best = value;
+                pivotColumn = j;
+                if (bland) break;
             }
         }
 
-        //verificando degeneração
-        if(pivots.find(pivotColumn) != pivots.end() && repeatOptimum > 2) {
-            for (i = 0; i < this->tableau.cols(); i++) {
-                if(pivots.find(i) == pivots.end() && this->tableau(0, i) < 0) {
-                    pivotColumn = i;
-                    break;
-                }
-            }
+        if (pivotColumn == -1) {
+            //solução ótima encontrada
+            break;
         }
 
-        pivots[pivotColumn] = this->tableau(0,pivotColumn);
-
         /*
-            Busca a linha pivotal, aplicando Bland Rule em caso de degeneração
+            Busca a linha pivotal
         */
-        if(repeatOptimum < 2) {
-            pivotRow = this->findPivot(pivotColumn, phase, false);
-        } else {
-            pivotRow = this->findPivot(pivotColumn, phase, true);
-        }
+        pivotRow = this->findPivot(pivotColumn, phase, bland, toUpper);
 
         if (pivotRow == -1) {
-            //sem solução
+            //sem solução (ilimitado)
+            if (phase == SECOND_PHASE) {
+                this->status = LP_UNBOUNDED;
+            }
+            return false;
+        }
+
+        if (this->isInterrupted()) {
             return false;
         }
 
+        this->iterations++;
+
+        if (pivotRow == BOUND_FLIP) {
+            //a variável que entra vai direto para o outro limite, sem troca de base
+            this->complementColumn(pivotColumn);
+            degenerate = 0;
+            continue;
+        }
+
+        if (toUpper) {
+            //a variável que sai vai para o limite superior
+            this->complementRow(pivotRow);
+        }
+
+        if (this->adjustPrecision(this->tableau(pivotRow, constantColumn)) == 0) {
+            degenerate++;
+        } else {
+            degenerate = 0;
+        }
+
         /*
             Operação com o pivo
         */
-        this->tableau.row(pivotRow) /= this->tableau(pivotRow, pivotColumn);
-        this->tableau(pivotRow, pivotColumn) = 1;   // Para problemas de precisao
-        for (i = 0; i < this->tableau.rows(); i++) {
-            if (i == pivotRow) continue;
+        this->pivot(pivotRow, pivotColumn);
+    }
+    return true;
+}
+
+/**
+ * @desc Simplex dual: parte de um tableau ótimo (custos reduzidos com o sinal correto)
+ * @desc com alguma variável básica fora dos seus limites e restaura a viabilidade.
+ *
+ * @param long long iterationLimit número máximo de pivôs (-1 sem limite)
+ * @returns bool Retorna true se uma solucao foi encontrada (ou o limite foi atingido), false caso o problema seja inviável ou o orçamento se esgote.
+ */
+bool Simplex::dualSimplexSolver(long long iterationLimit) {
+    long long pivotRow, pivotColumn, i, j, pivots = 0;
+    long long constantColumn = this->tableau.cols() - 1;
+    double ratio, minRatio, infeasibility, range, value;
+    int degenerate = 0;
+    bool aboveUpper, bland;
+
+    while (iterationLimit < 0 || pivots < iterationLimit) {
+
+        //Bland Rule após muitos pivôs degenerados seguidos (custos reduzidos nulos), para evitar ciclagem
+        bland = degenerate > TABLEAU_DEGENERATE_LIMIT;
+
+        /*
+            Busca a linha pivotal (maior violação de limite de uma variável básica,
+            ou a variável básica de menor índice com Bland Rule)
+        */
+        pivotRow = -1;
+        infeasibility = 0;
+        aboveUpper = false;
+        for (i = 1; i < this->tableau.rows(); i++) {
+            value = this->tableau(i, constantColumn);
+            if (bland && pivotRow != -1 && this->basis[i] > this->basis[pivotRow]) {
+                continue;
+            }
+            if (this->adjustPrecision(value) < 0 && (bland || -value > infeasibility)) {
+                pivotRow = i;
+                infeasibility = -value;
+                aboveUpper = false;
+            }
+            range = this->getRange(this->basis[i]);
+            if (!isinf(range) && this->adjustPrecision(value - range) > 0 && (bland || value - range > infeasibility)) {
+                pivotRow = i;
+                infeasibility = value - range;
+                aboveUpper = true;
+            }
+        }
+
+        if (pivotRow == -1) {
+            //todas as variáveis básicas estão dentro dos limites
+            break;
+        }
 
-            this->tableau.row(i) -= this->tableau.row(pivotRow) * this->tableau(i, pivotColumn);
-            this->tableau(i, pivotColumn) = 0;  // Para problemas de precisao
+        if (aboveUpper) {
+            //complementar a variável básica torna a violação um lado direito negativo
+            this->complementRow(pivotRow);
         }
 
-        //caso especial degeneracao
-        if(lastOptimum == this->tableau(0, this->tableau.cols()-1)) {
-            repeatOptimum++;
-            if(repeatOptimum > 5) {
-                return false;
+        /*
+            Busca a coluna pivotal (menor razão entre custo reduzido e coeficiente negativo da linha)
+        */
+        pivotColumn = -1;
+        minRatio = 0;
+        for (j = 0; j < constantColumn; j++) {
+            if (this->adjustPrecision(this->tableau(pivotRow, j)) >= 0) {
+                continue;
+            }
+            ratio = fabs(this->tableau(0, j) / this->tableau(pivotRow, j));
+            //em empates fica a coluna de menor índice
+            if (pivotColumn == -1 || this->adjustPrecision(ratio - minRatio) < 0) {
+                pivotColumn = j;
+                minRatio = ratio;
             }
         }
+
+        if (pivotColumn == -1) {
+            //sem solução
+            return false;
+        }
+
+        if (this->adjustPrecision(minRatio) == 0) {
+            degenerate++;
+        } else {
+            degenerate = 0;
+        }
+
+        if (this->isInterrupted()) {
+            return false;
+        }
+
+        this->iterations++;
+        pivots++;
+        this->pivot(pivotRow, pivotColumn);
     }
     return true;
 }
 
 /**
- * @desc Busca pela linha pivotal a partir da coluna pivotal
- * @desc Tenta achar a menor proporcao (ratio) não negativo.
- * @desc Retorna -1 se todas as proporções são negativas ou os candidatos a pivo sejam 0.
+ * @desc Operação com o pivô: zera a coluna pivotal em todas as linhas exceto a pivotal
+ *
+ * @param __int64 pivotRow linha pivotal
+ * @param __int64 pivotColumn coluna pivotal
+ * @returns void
+ */
+void Simplex::pivot(long long pivotRow, long long pivotColumn) {
+    this->tableau.row(pivotRow) /= this->tableau(pivotRow, pivotColumn);
+    this->tableau(pivotRow, pivotColumn) = 1;   // Para problemas de precisao
+    for (long long i = 0; i < this->tableau.rows(); i++) {
+        if (i == pivotRow) continue;
+
+        this->tableau.row(i) -= this->tableau.row(pivotRow) * this->tableau(i, pivotColumn);
+        this->tableau(i, pivotColumn) = 0;  // Para problemas de precisao
+    }
+    this->basis[pivotRow] = pivotColumn;
+}
+
+/**
+ * @desc Busca pela linha pivotal a partir da coluna pivotal (teste da razão com limites).
+ * @desc Uma variável básica pode sair pelo limite inferior (coeficiente positivo) ou pelo
+ * @desc superior (coeficiente negativo); a variável que entra pode apenas trocar de limite.
+ * @desc Retorna -1 se a coluna é ilimitada.
  *
- * @param bool bland habilita Bland Rule
  * @param __int64 column coluna pivotal
  * @param int phase indica a fase do metodo simplex
- * @returns __int64 Retorna o indice da linha pivotal ou -1 se não achou.
+ * @param bool bland habilita Bland Rule (desempate pelo menor índice da variável básica)
+ * @param bool &toUpper retorna true se a variável que sai vai para o limite superior
+ * @returns __int64 Retorna o indice da linha pivotal, BOUND_FLIP ou -1 se não achou.
  */
-long long Simplex::findPivot(long long column, int phase, bool bland) {
+long long Simplex::findPivot(long long column, int phase, bool bland, bool &toUpper) {
     long long minIndex = -1;
     long long constantColumn = this->tableau.cols() - 1;
-    double minRatio = 0;
-    double minConstant = 0; // Para "0/negativo < 0/positivo".
-    double ratio;
-    long long i = 1;
-    long long rowNum = this->tableau.rows();
-
-    if(phase == FIRST_PHASE) {
-        i++;
-    }
-
-    for (i; i < rowNum; i++) {
-        if (this->adjustPrecision(this->tableau(i, column)) == 0) {
+    double minRatio = 0, ratio, value, range;
+    bool upper;
+    long long i = (phase == FIRST_PHASE) ? 2 : 1;
+
+    toUpper = false;
+    for (; i < this->tableau.rows(); i++) {
+        value = this->tableau(i, column);
+        if (this->adjustPrecision(value) == 0) {
             continue;
         }
 
-        if(bland && this->adjustPrecision(this->tableau(i, constantColumn)) == 0) {
-            continue;
-        }
-
-        ratio = this->tableau(i, constantColumn) / this->tableau(i, column);
-        if (ratio < 0) {
-            //A proporção deve ser não negativo
-            continue;
+        if (value > 0) {
+            ratio = fmax(this->tableau(i, constantColumn), 0) / value;
+            upper = false;
+        } else {
+            range = this->getRange(this->basis[i]);
+            if (isinf(range)) {
+                continue;
+            }
+            ratio = fmax(range - this->tableau(i, constantColumn), 0) / -value;
+            upper = true;
         }
 
-        if (minIndex == -1) {
-            // Primeiro candidato a pivo
+        if (minIndex == -1 || this->adjustPrecision(ratio - minRatio) < 0) {
             minIndex = i;
             minRatio = ratio;
-            minConstant = this->tableau(i, constantColumn);
-        } else {
-            if (ratio == 0 && ratio == minRatio) {
-                // 0/negativo < 0/positivo
-                if (this->tableau(i, constantColumn) < minConstant) {
-                    minIndex = i;
-                    minRatio = ratio;
-                    minConstant = this->tableau(i, constantColumn);
-                }
-            } else if (ratio < minRatio) {
+            toUpper = upper;
+        } else if (this->adjustPrecision(ratio - minRatio) == 0) {
+            //empate: Bland Rule ou o maior pivô, por estabilidade numérica
+            if (bland ? this->basis[i] < this->basis[minIndex] : fabs(value) > fabs(this->tableau(minIndex, column))) {
                 minIndex = i;
-                minRatio = ratio;
-                minConstant = this->tableau(i, constantColumn);
+                minRatio = fmin(ratio, minRatio);
+                toUpper = upper;
             }
         }
     }
+
+    range = this->getRange(column);
+    if (!isinf(range) && (minIndex == -1 || range <= minRatio)) {
+        toUpper = false;
+        return BOUND_FLIP;
+    }
     return minIndex;
 }
 
 /**
- * @desc Retorna a linha que possui o valor 1, sendo os outros valores 0, da coluna passada como parametro.
- * @desc Caso contrário retorna -1.
- * @desc Método utilizado para construção da solução.
+ * @desc Retorna a amplitude (limite superior - limite inferior) da variável da coluna.
+ * @desc Folgas e artificiais não possuem limite superior.
  *
- * @param __int64 column
- * @returns __int64
+ * @param long long column coluna do tableau
+ * @returns double
  */
-long long Simplex::getPivotRow(long long column) {
-    long long one_row = -1;
+double Simplex::getRange(long long column) {
+    if (column < 0 || column >= this->numberOfVariables) {
+        return numeric_limits<double>::infinity();
+    }
+    return this->upperBounds(column) - this->lowerBounds(column);
+}
 
-    for (long long i = 1; i < this->tableau.rows(); i++) {
-        if (this->tableau(i, column) == 1) {
-            if (one_row >= 0) {
-                return -1;
-            } else {
-                one_row = i;
-                continue;
+/**
+ * @desc Complementa uma variável não básica: passa a ser medida a partir do outro limite.
+ *
+ * @param long long column coluna da variável
+ * @returns void
+ */
+void Simplex::complementColumn(long long column) {
+    long long constantColumn = this->tableau.cols() - 1;
+
+    this->tableau.col(constantColumn) -= this->tableau.col(column) * this->getRange(column);
+    this->tableau.col(column) = -this->tableau.col(column);
+    this->complemented[column] = !this->complemented[column];
+}
+
+/**
+ * @desc Complementa a variável básica de uma linha: v' = range - v.
+ *
+ * @param long long row linha da variável básica
+ * @returns void
+ */
+void Simplex::complementRow(long long row) {
+    long long constantColumn = this->tableau.cols() - 1;
+    long long column = this->basis[row];
+    double range = this->getRange(column);
+
+    this->tableau.row(row) = -this->tableau.row(row);
+    this->tableau(row, column) = 1;
+    this->tableau(row, constantColumn) += range;
+    this->complemented[column] = !this->complemented[column];
+}
+
+/**
+ * @desc Retira do tableau a primeira fase: variáveis artificiais que ficaram básicas (com valor 0)
+ * @desc são trocadas por uma coluna não artificial ou, se não existir, a linha é redundante e removida.
+ *
+ * @param int numberOfArtificials número de variáveis artificiais (últimas colunas antes do lado direito)
+ * @returns void
+ */
+void Simplex::removeArtificials(int numberOfArtificials) {
+    long long firstArtificial = this->tableau.cols() - 1 - numberOfArtificials;
+    long long pivotColumn, j;
+    double best;
+
+    for (long long i = this->tableau.rows() - 1; i >= 2; i--) {
+        if (this->basis[i] < firstArtificial) {
+            continue;
+        }
+
+        pivotColumn = -1;
+        best = 0;
+        for (j = 0; j < firstArtificial; j++) {
+            if (this->adjustPrecision(this->tableau(i, j)) != 0 && fabs(this->tableau(i, j)) > best) {
+                best = fabs(this->tableau(i, j));
+                pivotColumn = j;
             }
-        } else if (this->tableau(i, column) != 0) {
-            return -1;
+        }
+
+        if (pivotColumn == -1) {
+            //restrição redundante
+            this->removeRow(i);
+        } else {
+            this->pivot(i, pivotColumn);
         }
     }
 
-    return one_row;
+    //remove a primeira linha criada para cancelar as variáveis artificiais
+    this->removeRow(0);
+    //remove as colunas das variáveis artificiais
+    for(long long  i = 0; i < numberOfArtificials; i++) {
+        this->removeColumn(this->tableau.cols() - 2);
+    }
 }
 
 /**
@@ -321,6 +790,7 @@ void Simplex::removeRow(long long rowToRemove) {
                 this->tableau.block(rowToRemove + 1, 0, numRows - rowToRemove, numCols);
     }
     this->tableau.conservativeResize(numRows,numCols);
+    this->basis.erase(this->basis.begin() + rowToRemove);
 }
 
 /**
@@ -338,44 +808,15 @@ void Simplex::removeColumn(long long colToRemove) {
                 this->tableau.block(0, colToRemove + 1, numRows, numCols - colToRemove);
     }
     this->tableau.conservativeResize(numRows,numCols);
-}
-
-/**
- * @desc Método para validar a entrada do solver
- *
- * @param os mesmos do método construtor
- * @throw Exception caso a entrada seja inválida
- * @returns void
- */
-void Simplex::isValidEntry(int mode, const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations) {
-    long long temp;
-
-    if (mode != SIMPLEX_MINIMIZE && mode != SIMPLEX_MAXIMIZE) {
-        throw(new Exception("Simplex: modo invalido!."));
-    }
-
-    if (objectiveFunction.rows() < 1) {
-        throw(new Exception("Simplex: Deve conter pelo menos um coeficiente na funcao objetivo."));
-    }
-
-    if (constraints.rows() < 1) {
-        throw(new Exception("Simplex: Deve ter pelo menos uma restricao."));
-    }
-
-    if (constraints.cols() != objectiveFunction.rows() + 1) {
-        throw(new Exception("Simplex: numero de coeficientes da funcao objetivo diferente do número de coeficientes de restrição."));
-    }
-
-    if (relations.rows() != constraints.rows()) {
-        throw(new Exception("Simplex: numero de relacoes diferentes do numero de restricoes."));
-    }
-
-    temp = constraints.cols() - 1;
-    for (long long i = 0; i < constraints.rows(); i++) {
-        if (constraints(i, temp) < 0) {
-            throw(new Exception("Simplex: Todo lado direito da tabela de restricoes deve ser nao negativo."));
+    for (long long i = 0; i < (long long) this->basis.size(); i++) {
+        if (this->basis[i] > colToRemove) {
+            this->basis[i]--;
         }
     }
+    if (colToRemove >= this->numberOfVariables && colToRemove - this->numberOfVariables < (long long) this->slackIds.size()) {
+        this->slackDefinitions.erase(this->slackDefinitions.begin() + (colToRemove - this->numberOfVariables));
+        this->slackIds.erase(this->slackIds.begin() + (colToRemove - this->numberOfVariables));
+    }
 }
 
 /**
@@ -384,132 +825,122 @@ void Simplex::isValidEntry(int mode, const VectorXd &objectiveFunction, const Ma
  * @returns void
  */
 void Simplex::searchSolution() {
-    long long constantColumn, temp;
+    long long constantColumn = this->tableau.cols() - 1;
+    VectorXd values = VectorXd::Zero(this->numberOfVariables);
 
-    constantColumn = this->tableau.cols() - 1;
-    this->solution.resize(this->numberOfVariables);
+    for (long long i = 1; i < this->tableau.rows(); i++) {
+        if (this->basis[i] < this->numberOfVariables) {
+            values(this->basis[i]) = this->tableau(i, constantColumn);
+        }
+    }
 
+    this->solution.resize(this->numberOfVariables);
     for (long long i = 0; i < this->numberOfVariables; i++) {
-        temp = this->getPivotRow(i);
-        if (temp > 0) {
-            // Variavel basica
-            this->solution(i) = this->tableau(temp, constantColumn);
+        // ajusta a precisão, pois os pivôs do Simplex dual acumulam erros
+        if (this->complemented[i]) {
+            this->solution(i) = this->adjustPrecision(this->upperBounds(i) - values(i));
         } else {
-            // Variavel nao basica
-            this->solution(i) = 0;
+            this->solution(i) = this->adjustPrecision(this->lowerBounds(i) + values(i));
         }
     }
 
     this->foundSolution = true;
-    this->optimum = this->tableau(0, constantColumn);
+    this->status = LP_OPTIMAL;
+    this->optimum = this->adjustPrecision(this->tableau(0, constantColumn));
 }
 
 /**
  * @desc Método para construir tableau inicial
+ * @desc Colunas: [variáveis | folgas | artificiais | lado direito]
+ * @desc As variáveis são deslocadas para os limites inferiores e linhas com lado direito
+ * @desc negativo são multiplicadas por -1 (invertendo a relação).
  *
- * @param os mesmos do método construtor
+ * @param Problem *problem problema a ser resolvido
  * @returns int número de variáveis artificiais
  */
-int Simplex::buildTableau(int mode, const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations) {
-    long long temp;
+int Simplex::buildTableau(Problem *problem) {
+    const SparseMatrixXd &constraints = problem->getConstraints();
+    VectorXd objectiveFunction = problem->getObjectiveFunction();
+    VectorXd relations = problem->getRelations();
+    long long numberOfConstraints = constraints.rows();
+    long long numberOfSlacks = 0, firstRow, constantColumn, slack, artificial, row;
     int numberOfArtificials = 0;
-
-    for(long long i = 0; i < relations.rows(); i++) {
-        if(relations(i) != 0) {
-            numberOfArtificials++;
+    VectorXd rhs = VectorXd::Zero(numberOfConstraints);
+    VectorXd signs = VectorXd::Ones(numberOfConstraints);
+
+    //lado direito com as variáveis deslocadas para os limites inferiores
+    for (long long i = 0; i < numberOfConstraints; i++) {
+        for (SparseMatrixXd::InnerIterator it(constraints, i); it; ++it) {
+            if (it.col() < this->numberOfVariables) {
+                rhs(i) -= it.value() * this->lowerBounds(it.col());
+            } else {
+                rhs(i) += it.value();
+            }
         }
-    }
-
-    if(numberOfArtificials > 0) {
-        this->tableau.resize(constraints.rows() + 2, this->numberOfVariables + constraints.rows() + numberOfArtificials + 1);
-
-        this->tableau <<    MatrixXd::Zero(1, constraints.rows() + this->numberOfVariables + numberOfArtificials + 1),
-                -objectiveFunction.transpose(), MatrixXd::Zero(1, constraints.rows() + numberOfArtificials + 1),
-                constraints.leftCols(this->numberOfVariables),  MatrixXd::Identity(constraints.rows(), constraints.rows()), MatrixXd::Zero(constraints.rows(), numberOfArtificials), constraints.rightCols(1);
-        temp = 0;
-        for(long long i = 2; i < this->tableau.rows(); i++) {
-            if(relations(i-2) == 1) {
-                this->tableau(i, this->numberOfVariables + i - 2) = -1;
-                this->tableau.row(0)+=this->tableau.row(i)*relations(i-2);
-                this->tableau(i, this->tableau.cols() - numberOfArtificials - 1 + temp) = 1;
-                temp++;
-            } else if (relations(i-2) == 2) {
-                removeColumn(this->numberOfVariables + i - 2);
-                this->tableau.row(0)+=this->tableau.row(i)*relations(i-2);
-                this->tableau(i, this->tableau.cols() - numberOfArtificials - 1 + temp) = 1;
-                temp++;
+        if (rhs(i) < 0) {
+            signs(i) = -1;
+            if (relations(i) != 2) {
+                relations(i) = 1 - relations(i);
             }
         }
-    } else {
-        this->tableau.resize(constraints.rows() + 1, this->numberOfVariables + constraints.rows() + 1);
-
-        this->tableau <<    -objectiveFunction.transpose(), MatrixXd::Zero(1, constraints.rows() + 1),
-                constraints.leftCols(this->numberOfVariables),  MatrixXd::Identity(constraints.rows(), constraints.rows()), constraints.rightCols(1);
-    }
-
-    return numberOfArtificials;
-}
-
-/**
- * @desc Método para construir tableau inicial com cortes
- *
- * @param os mesmos do método construtor com cortes
- * @returns int variáveis artificiais
- */
-int Simplex::buildTableauWithCuts(int mode, const VectorXd &objectiveFunction, const MatrixXd &constraints, const VectorXd &relations, const MatrixXd &cuts) {
-    long long temp;
-    int numberOfArtificials = 0, numberOfCuts;
-
-    for(long long i = 0; i < relations.rows(); i++) {
+        if(relations(i) != 2) {
+            numberOfSlacks++;
+        }
         if(relations(i) != 0) {
             numberOfArtificials++;
         }
     }
 
-    numberOfCuts = cuts.rows();
-    numberOfArtificials += numberOfCuts;
-
-    this->tableau.resize(constraints.rows() + numberOfCuts + 2 , this->numberOfVariables + constraints.rows() + numberOfArtificials + numberOfCuts + 1);
-
-    this->tableau <<    MatrixXd::Zero(1, constraints.rows() + this->numberOfVariables + numberOfArtificials + numberOfCuts + 1),
-            -objectiveFunction.transpose(), MatrixXd::Zero(1, constraints.rows() + numberOfArtificials + numberOfCuts + 1),
-            constraints.leftCols(this->numberOfVariables),  MatrixXd::Identity(constraints.rows(), constraints.rows()), MatrixXd::Zero(constraints.rows(), numberOfArtificials+numberOfCuts), constraints.rightCols(1),
-            cuts, MatrixXd::Zero(numberOfCuts, this->tableau.cols() - cuts.cols());
-
-    if (numberOfArtificials != numberOfCuts) {
-        temp = 0;
-        for(long long i = 2; i < this->tableau.rows()-numberOfCuts; i++) {
-            if(relations(i-2) == 1) {
-                this->tableau(i, this->numberOfVariables + i - 2) = -1;
-                this->tableau.row(0)+=this->tableau.row(i)*relations(i-2);
-                this->tableau(i, this->tableau.cols() - numberOfArtificials - 1 + temp) = 1;
-                temp++;
-            } else if (relations(i-2) == 2) {
-                removeColumn(this->numberOfVariables + i - 2);
-                this->tableau.row(0)+=this->tableau.row(i)*relations(i-2);
-                this->tableau(i, this->tableau.cols() - numberOfArtificials - 1 + temp) = 1;
-                temp++;
+    //com variáveis artificiais a primeira linha é a função objetivo da primeira fase
+    firstRow = (numberOfArtificials > 0) ? 2 : 1;
+    constantColumn = this->numberOfVariables + numberOfSlacks + numberOfArtificials;
+
+    this->tableau = MatrixXd::Zero(numberOfConstraints + firstRow, constantColumn + 1);
+    this->tableau.row(firstRow - 1).head(this->numberOfVariables) = -objectiveFunction.transpose();
+    this->tableau(firstRow - 1, constantColumn) = objectiveFunction.dot(this->lowerBounds);
+    this->basis.assign(this->tableau.rows(), -1);
+    this->slackDefinitions.clear();
+    this->slackIds.clear();
+
+    slack = this->numberOfVariables;
+    artificial = this->numberOfVariables + numberOfSlacks;
+    for(long long i = 0; i < numberOfConstraints; i++) {
+        row = i + firstRow;
+        this->fillRow(row, signs(i), constraints, i);
+        this->tableau(row, constantColumn) = signs(i) * rhs(i);
+        //folga de <=: s = sinal * (b - a.x); folga de >=: s = sinal * (a.x - b)
+        if(relations(i) != 2) {
+            this->addSlackDefinition(constraints.row(i).transpose(), (relations(i) == 0) ? -signs(i) : signs(i), -1);
+        }
+        if(relations(i) == 0) {
+            this->tableau(row, slack) = 1;
+            this->basis[row] = slack++;
+        } else {
+            if(relations(i) == 1) {
+                this->tableau(row, slack++) = -1;
             }
+            this->tableau.row(0) += this->tableau.row(row);
+            this->tableau(row, artificial) = 1;
+            this->basis[row] = artificial++;
         }
     }
 
-    for(int i = 0; i < numberOfCuts; i++) {
-        this->tableau(this->tableau.rows()-1-i, this->tableau.cols()-1) = this->tableau(this->tableau.rows()-1-i, cuts.cols()-1);
-        this->tableau(this->tableau.rows()-1-i, cuts.cols()-1) = 0;
-        this->tableau(this->tableau.rows()-1-i, cuts.cols()-1-i) = -1;
-        this->tableau.row(0)+=this->tableau.row(this->tableau.rows()-1-i);
-        this->tableau(this->tableau.rows()-1-i, this->tableau.cols() - 2 - i) = 1;
-    }
-
     return numberOfArtificials;
 }
 
 /**
- * @desc Ajusta precisão do valor passado como parâmetro em 5 casas decimais
+ * @desc Copia os não zeros de uma restrição esparsa para a linha do tableau (sem o lado direito)
  *
- * @param double value valor a ser ajustado
- * @returns double valor ajustado
+ * @param long long row linha do tableau
+ * @param double sign sinal aplicado aos coeficientes
+ * @param const SparseMatrixXd &constraints Matriz esparsa com todas as restricoes.
+ * @param long long constraint índice da restrição
+ * @returns void
  */
-double Simplex::adjustPrecision(double value) {
-    return (floor((value * pow(10, 5) + 0.5)) / pow(10, 5));
+void Simplex::fillRow(long long row, double sign, const SparseMatrixXd &constraints, long long constraint) {
+    for (SparseMatrixXd::InnerIterator it(constraints, constraint); it; ++it) {
+        if (it.col() < this->numberOfVariables) {
+            this->tableau(row, it.col()) = sign * it.value();
+        }
+    }
 }
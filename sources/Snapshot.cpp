@@ -0,0 +1,307 @@
+#include "../headers/Snapshot.h"
+#include "../headers/Exception.h"
+#include <fstream>
+#include <cstring>
+#include <utility>
+
+using namespace Eigen;
+
+static_assert(sizeof(SparseMatrixXd::StorageIndex) == sizeof(int32_t), "os indices da matriz precisam ter 32 bits");
+static_assert(sizeof(SnapshotHeader) % SNAPSHOT_ALIGNMENT == 0, "o cabecalho precisa manter o alinhamento");
+
+/**
+ * @desc Construtor: carrega o snapshot do conteúdo em memória (normalmente o arquivo mapeado),
+ * @desc validando o cabeçalho, os limites de cada seção e os índices da matriz
+ *
+ * @param const char *begin início do conteúdo do arquivo
+ * @param const char *end fim do conteúdo
+ */
+Snapshot::Snapshot(const char *begin, const char *end) {
+    SnapshotHeader header;
+    uint64_t size = end - begin;
+    long long m, n, nonzeros;
+    int32_t relation;
+    const uint64_t *nameOffsets;
+
+    if(size < sizeof(SnapshotHeader)) {
+        Snapshot::error("arquivo truncado");
+    }
+    memcpy(&header, begin, sizeof(SnapshotHeader));
+    if(memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+        Snapshot::error("identificacao invalida");
+    }
+    if(header.byteOrder != SNAPSHOT_BYTE_ORDER) {
+        Snapshot::error("ordem de bytes diferente da desta maquina");
+    }
+    if(header.version != SNAPSHOT_VERSION) {
+        Snapshot::error("versao " + to_string(header.version) + " nao suportada");
+    }
+    if(header.size != size || header.rows < 0 || header.columns < 1 || header.nonzeros < 0
+        || (uint64_t) header.rows > size || (uint64_t) header.columns > size || (uint64_t) header.nonzeros > size
+        || (header.mode != 1 && header.mode != 2)) {
+        Snapshot::error("cabecalho corrompido");
+    }
+    m = header.rows;
+    n = header.columns;
+    nonzeros = header.nonzeros;
+
+    //cada seção precisa caber no arquivo
+    auto check = [&](uint64_t offset, uint64_t bytes) {
+        if(offset > size || bytes > size - offset) {
+            Snapshot::error("secao fora do arquivo");
+        }
+    };
+    check(header.objective, n * sizeof(double));
+    check(header.lowerBounds, n * sizeof(double));
+    check(header.upperBounds, n * sizeof(double));
+    check(header.relations, m * sizeof(int32_t));
+    check(header.outerIndex, (m + 1) * sizeof(int32_t));
+    check(header.innerIndex, nonzeros * sizeof(int32_t));
+    check(header.values, nonzeros * sizeof(double));
+    check(header.integers, n);
+    check(header.nameOffsets, (n + 1) * sizeof(uint64_t));
+
+    VectorXd objective(n), lowerBounds(n), upperBounds(n), relations(m);
+    memcpy(objective.data(), begin + header.objective, n * sizeof(double));
+    memcpy(lowerBounds.data(), begin + header.lowerBounds, n * sizeof(double));
+    memcpy(upperBounds.data(), begin + header.upperBounds, n * sizeof(double));
+    for(long long i = 0; i < m; i++) {
+        memcpy(&relation, begin + header.relations + i * sizeof(int32_t), sizeof(int32_t));
+        if(relation < 0 || relation > 2) {
+            Snapshot::error("relacao invalida");
+        }
+        relations(i) = relation;
+    }
+
+    SparseMatrixXd constraints(m, n + 1);
+    constraints.resizeNonZeros(nonzeros);
+    memcpy(constraints.outerIndexPtr(), begin + header.outerIndex, (m + 1) * sizeof(int32_t));
+    memcpy(constraints.innerIndexPtr(), begin + header.innerIndex, nonzeros * sizeof(int32_t));
+    memcpy(constraints.valuePtr(), begin + header.values, nonzeros * sizeof(double));
+    if(constraints.outerIndexPtr()[0] != 0 || constraints.outerIndexPtr()[m] != nonzeros) {
+        Snapshot::error("matriz corrompida");
+    }
+    this->nonzeros = 0;
+    for(long long i = 0; i < m; i++) {
+        if(constraints.outerIndexPtr()[i+1] < constraints.outerIndexPtr()[i]) {
+            Snapshot::error("matriz corrompida");
+        }
+        for(long long k = constraints.outerIndexPtr()[i]; k < constraints.outerIndexPtr()[i+1]; k++) {
+            if(constraints.innerIndexPtr()[k] < 0 || constraints.innerIndexPtr()[k] > n
+                || (k > constraints.outerIndexPtr()[i] && constraints.innerIndexPtr()[k] <= constraints.innerIndexPtr()[k-1])) {
+                Snapshot::error("matriz corrompida");
+            }
+            this->nonzeros += (constraints.innerIndexPtr()[k] < n);
+        }
+    }
+
+    this->variableTypes.resize(n);
+    for(long long j = 0; j < n; j++) {
+        this->variableTypes[j] = (unsigned char) begin[header.integers + j];
+        if(this->variableTypes[j] > BINARY_VARIABLE) {
+            Snapshot::error("integralidade corrompida");
+        }
+    }
+
+    nameOffsets = (const uint64_t*) (begin + header.nameOffsets);
+    this->names.resize(n);
+    for(long long j = 0; j < n; j++) {
+        uint64_t first, last;
+        memcpy(&first, nameOffsets + j, sizeof(uint64_t));
+        memcpy(&last, nameOffsets + j + 1, sizeof(uint64_t));
+        if(last < first) {
+            Snapshot::error("nomes corrompidos");
+        }
+        check(header.names + first, last - first);
+        this->names[j].assign(begin + header.names + first, last - first);
+    }
+
+    this->problem = new Problem(objective, move(constraints), relations);
+    for(long long j = 0; j < n; j++) {
+        this->problem->setBounds(j, lowerBounds(j), upperBounds(j));
+        this->problem->setVariableType(j, this->variableTypes[j]);
+    }
+    this->problem->setVariableNames(this->names);
+    this->mode = header.mode;
+    this->objectiveOffset = header.objectiveOffset;
+}
+
+/**
+ * @desc Verifica se o conteúdo começa com a identificação do snapshot
+ *
+ * @param const char *begin
+ * @param const char *end
+ * @returns bool
+ */
+bool Snapshot::isSnapshot(const char *begin, const char *end) {
+    return end - begin >= (long long) sizeof(SnapshotHeader) && memcmp(begin, SNAPSHOT_MAGIC, 8) == 0;
+}
+
+/**
+ * @desc Grava o problema no formato do snapshot: o cabeçalho e cada seção alinhada a 8 bytes.
+ * @desc Todas as variáveis são marcadas como inteiras; os nomes são os do problema (ou x1..xn)
+ *
+ * @param const string fileName
+ * @param Problem *problem
+ * @param int mode 1 minimiza, 2 maximiza
+ * @param double objectiveOffset constante da função objetivo
+ * @returns void
+ */
+void Snapshot::write(const string fileName, Problem *problem, int mode, double objectiveOffset) {
+    static const char padding[SNAPSHOT_ALIGNMENT] = {0};
+    ofstream file(fileName.c_str(), ios::out | ios::binary);
+    const SparseMatrixXd &constraints = problem->getConstraints();
+    VectorXd objective = problem->getObjectiveFunction();
+    VectorXd lowerBounds = problem->getLowerBounds();
+    VectorXd upperBounds = problem->getUpperBounds();
+    VectorXd relationsVector = problem->getRelations();
+    long long m = constraints.rows(), n = objective.size(), nonzeros = constraints.nonZeros();
+    vector<int32_t> relations(m);
+    vector<uint8_t> integers(n);
+    vector<uint64_t> nameOffsets(n + 1, 0);
+    SnapshotHeader header;
+    uint64_t position, written = 0;
+    string names;
+
+    if(!file.is_open()) {
+        throw(new Exception("Snapshot: Nao foi possivel criar o arquivo " + fileName + "!"));
+    }
+
+    for(long long i = 0; i < m; i++) {
+        relations[i] = relationsVector(i);
+    }
+    for(long long j = 0; j < n; j++) {
+        integers[j] = problem->getVariableType(j);
+        names += problem->getVariableName(j);
+        nameOffsets[j+1] = names.size();
+    }
+
+    memset(&header, 0, sizeof(SnapshotHeader));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.mode = mode;
+    header.rows = m;
+    header.columns = n;
+    header.nonzeros = nonzeros;
+    header.objectiveOffset = objectiveOffset;
+
+    position = sizeof(SnapshotHeader);
+    header.objective = position;
+    position = Snapshot::align(position + n * sizeof(double));
+    header.lowerBounds = position;
+    position = Snapshot::align(position + n * sizeof(double));
+    header.upperBounds = position;
+    position = Snapshot::align(position + n * sizeof(double));
+    header.relations = position;
+    position = Snapshot::align(position + m * sizeof(int32_t));
+    header.outerIndex = position;
+    position = Snapshot::align(position + (m + 1) * sizeof(int32_t));
+    header.innerIndex = position;
+    position = Snapshot::align(position + nonzeros * sizeof(int32_t));
+    header.values = position;
+    position = Snapshot::align(position + nonzeros * sizeof(double));
+    header.integers = position;
+    position = Snapshot::align(position + n);
+    header.nameOffsets = position;
+    position = Snapshot::align(position + (n + 1) * sizeof(uint64_t));
+    header.names = position;
+    header.size = Snapshot::align(position + names.size());
+
+    //cada seção começa no seu deslocamento, com zeros no alinhamento
+    auto section = [&](uint64_t offset, const void *data, uint64_t bytes) {
+        file.write(padding, offset - written);
+        file.write((const char*) data, bytes);
+        written = offset + bytes;
+    };
+    section(0, &header, sizeof(SnapshotHeader));
+    section(header.objective, objective.data(), n * sizeof(double));
+    section(header.lowerBounds, lowerBounds.data(), n * sizeof(double));
+    section(header.upperBounds, upperBounds.data(), n * sizeof(double));
+    section(header.relations, relations.data(), m * sizeof(int32_t));
+    section(header.outerIndex, constraints.outerIndexPtr(), (m + 1) * sizeof(int32_t));
+    section(header.innerIndex, constraints.innerIndexPtr(), nonzeros * sizeof(int32_t));
+    section(header.values, constraints.valuePtr(), nonzeros * sizeof(double));
+    section(header.integers, integers.data(), n);
+    section(header.nameOffsets, nameOffsets.data(), (n + 1) * sizeof(uint64_t));
+    section(header.names, names.data(), names.size());
+    section(header.size, NULL, 0);
+
+    if(!file.good()) {
+        throw(new Exception("Snapshot: Erro ao escrever o arquivo " + fileName + "!"));
+    }
+}
+
+/**
+ * @desc Arredonda a posição para o próximo múltiplo do alinhamento
+ *
+ * @param uint64_t position
+ * @returns uint64_t
+ */
+uint64_t Snapshot::align(uint64_t position) {
+    return (position + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+/**
+ * @desc Interrompe a carga do snapshot
+ *
+ * @param const string &detail
+ * @returns void
+ */
+void Snapshot::error(const string &detail) {
+    throw(new Exception("Snapshot: Arquivo invalido (" + detail + ")!"));
+}
+
+/**
+ * @desc Retorna o problema carregado
+ *
+ * @returns Problem*
+ */
+Problem* Snapshot::getProblem() {
+    return this->problem;
+}
+
+/**
+ * @desc Retorna o modo (1 minimização, 2 maximização)
+ *
+ * @returns int
+ */
+int Snapshot::getMode() {
+    return this->mode;
+}
+
+/**
+ * @desc Retorna o número de coeficientes não nulos das restrições (sem o lado direito)
+ *
+ * @returns long long
+ */
+long long Snapshot::getNonzeros() {
+    return this->nonzeros;
+}
+
+/**
+ * @desc Retorna a constante da função objetivo
+ *
+ * @returns double
+ */
+double Snapshot::getObjectiveOffset() {
+    return this->objectiveOffset;
+}
+
+/**
+ * @desc Retorna a integralidade de cada variável
+ *
+ * @returns const vector<int>&
+ */
+const vector<int>& Snapshot::getVariableTypes() {
+    return this->variableTypes;
+}
+
+/**
+ * @desc Retorna o nome de cada variável
+ *
+ * @returns const vector<string>&
+ */
+const vector<string>& Snapshot::getNames() {
+    return this->names;
+}
@@ -0,0 +1,126 @@
+#include "../headers/SymbolTable.h"
+#include <cstring>
+
+/**
+ * @desc Construtor: tabela vazia
+ */
+SymbolTable::SymbolTable() {
+    this->offsets.push_back(0);
+    this->slots.assign(SYMBOL_TABLE_INITIAL_SLOTS, make_pair(0, -1));
+}
+
+/**
+ * @desc Retorna o identificador do nome, criando um novo (o próximo inteiro) se ele ainda não existe
+ *
+ * @param const char *begin início do nome
+ * @param const char *end fim do nome
+ * @returns long long
+ */
+long long SymbolTable::intern(const char *begin, const char *end) {
+    uint64_t code = SymbolTable::hash(begin, end);
+    long long slot = this->findSlot(begin, end, code), id;
+
+    if(this->slots[slot].second != -1) {
+        return this->slots[slot].second;
+    }
+
+    id = this->hashes.size();
+    this->characters.append(begin, end - begin);
+    this->offsets.push_back(this->characters.size());
+    this->hashes.push_back(code);
+    this->slots[slot] = make_pair(code, id);
+    //mantém a ocupação em até metade dos espaços, para as sondagens continuarem curtas
+    if(2 * this->hashes.size() > this->slots.size()) {
+        this->grow();
+    }
+    return id;
+}
+
+/**
+ * @desc Busca o identificador do nome
+ *
+ * @param const char *begin início do nome
+ * @param const char *end fim do nome
+ * @returns long long -1 se o nome não existe
+ */
+long long SymbolTable::find(const char *begin, const char *end) {
+    return this->slots[this->findSlot(begin, end, SymbolTable::hash(begin, end))].second;
+}
+
+/**
+ * @desc Sondagem linear: o espaço do nome ou o primeiro espaço vazio da sequência
+ *
+ * @param const char *begin
+ * @param const char *end
+ * @param uint64_t code espalhamento do nome
+ * @returns long long
+ */
+long long SymbolTable::findSlot(const char *begin, const char *end, uint64_t code) {
+    size_t mask = this->slots.size() - 1, length = end - begin;
+    size_t slot = code & mask;
+    long long id;
+
+    //o espalhamento guardado no espaço evita acessar o nome na maioria das comparações
+    while((id = this->slots[slot].second) != -1) {
+        if(this->slots[slot].first == code && this->offsets[id+1] - this->offsets[id] == length
+            && memcmp(this->characters.data() + this->offsets[id], begin, length) == 0) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * @desc Dobra a tabela de espalhamento e reinsere os identificadores (os espalhamentos estão guardados)
+ *
+ * @returns void
+ */
+void SymbolTable::grow() {
+    size_t mask = 2 * this->slots.size() - 1, slot;
+
+    this->slots.assign(mask + 1, make_pair(0, -1));
+    for(size_t id = 0; id < this->hashes.size(); id++) {
+        slot = this->hashes[id] & mask;
+        while(this->slots[slot].second != -1) {
+            slot = (slot + 1) & mask;
+        }
+        this->slots[slot] = make_pair(this->hashes[id], (long long) id);
+    }
+}
+
+/**
+ * @desc Espalhamento FNV-1a de 64 bits, com uma mistura final para os bits baixos usados no índice
+ *
+ * @param const char *begin
+ * @param const char *end
+ * @returns uint64_t
+ */
+uint64_t SymbolTable::hash(const char *begin, const char *end) {
+    uint64_t code = 14695981039346656037ULL;
+
+    for(; begin != end; begin++) {
+        code = (code ^ (unsigned char) *begin) * 1099511628211ULL;
+    }
+    code ^= code >> 32;
+    return code;
+}
+
+/**
+ * @desc Retorna o número de nomes
+ *
+ * @returns long long
+ */
+long long SymbolTable::size() {
+    return this->hashes.size();
+}
+
+/**
+ * @desc Retorna o nome de um identificador
+ *
+ * @param long long id
+ * @returns string
+ */
+string SymbolTable::getName(long long id) {
+    return this->characters.substr(this->offsets[id], this->offsets[id+1] - this->offsets[id]);
+}